@@ -1,5 +1,7 @@
 TEMPLATE = app
 
+CONFIG += thread
+
 TARGET = AmazingOfflineShop
 
 SOURCES += main.cc
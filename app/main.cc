@@ -1,5 +1,8 @@
+#include <chrono>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <memory>
 
@@ -7,12 +10,32 @@
 #include <objects/Discounts.h>
 #include <objects/Orders.h>
 #include <objects/ProcessedOrders.h>
+#include <objects/OrderBatch.h>
+#include <objects/OrderPipeline.h>
+#include <bill/IBillSink.h>
 #include <file_reader/CsvReader.h>
 
 // argv[1] shall be path to the items CSV
 // argv[2] shall be path to the discounts CSV
+// optional "--threads N" loads items & discounts CSV on N threads (0 means hardware concurrency)
+// optional "--error-budget N" skips up to N malformed rows of every CSV instead of failing on the first one
+// optional "--fused" prices order rows while they are read, without intermediate Orders
+// optional "--batch PATH" processes every order CSV of directory (or listed within manifest file) on "--threads N" threads
+// optional "--pipeline P,R,W" processes batch in parse, price & write stages with P, R & W threads instead
+// optional "--queue-capacity N" number of orders waiting between pipeline stages (4 by default)
+// optional "--async-io N" reads orders & writes bills of batch with asynchronous I/O, N files in flight per thread
+// optional "--bill-format FORMAT" writes bills as "text" (default), "csv", "jsonl" or "binary"
 int main(int argc, char* argv[])
 {
+    std::vector<std::string> arguments;
+    size_t num_threads = 1;
+    size_t error_budget = 0;
+    bool fused = false;
+    std::string batch_path;
+    bool pipeline = false;
+    OrderPipelineConfig pipeline_config;
+    size_t num_in_flight = 0;
+    std::shared_ptr<const IBillSink> bill_sink = IBillSink::create("text");
     std::shared_ptr<CsvReader> csv_reader(new CsvReader);
     std::ofstream txt_writer;
 
@@ -24,13 +47,76 @@ int main(int argc, char* argv[])
     ProcessedOrders processed_orders;
     std::string filename;
 
-    int i = 1;
+    // separate options from file arguments
+    for (int j = 1; j < argc; j++)
+    {
+        if (std::string(argv[j]) == "--threads" && j + 1 < argc)
+        {
+            num_threads = std::stoul(argv[++j]);
+        }
+        else if (std::string(argv[j]) == "--error-budget" && j + 1 < argc)
+        {
+            error_budget = std::stoul(argv[++j]);
+        }
+        else if (std::string(argv[j]) == "--batch" && j + 1 < argc)
+        {
+            batch_path = argv[++j];
+        }
+        else if (std::string(argv[j]) == "--pipeline" && j + 1 < argc)
+        {
+            // thread counts of stages separated by commas
+            std::stringstream stages(argv[++j]);
+            std::string count;
+            size_t* const counts[] = {&pipeline_config.parseThreads, &pipeline_config.priceThreads, &pipeline_config.writeThreads};
+            for (size_t* stage : counts)
+            {
+                if (std::getline(stages, count, ','))
+                {
+                    *stage = std::stoul(count);
+                }
+            }
+            pipeline = true;
+        }
+        else if (std::string(argv[j]) == "--queue-capacity" && j + 1 < argc)
+        {
+            pipeline_config.queueCapacity = std::stoul(argv[++j]);
+        }
+        else if (std::string(argv[j]) == "--async-io" && j + 1 < argc)
+        {
+            num_in_flight = std::stoul(argv[++j]);
+        }
+        else if (std::string(argv[j]) == "--bill-format" && j + 1 < argc)
+        {
+            try
+            {
+                bill_sink = IBillSink::create(argv[++j]);
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << e.what() << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        else if (std::string(argv[j]) == "--fused")
+        {
+            fused = true;
+        }
+        else
+        {
+            arguments.push_back(argv[j]);
+        }
+    }
+
+    size_t i = 0;
+    orders.setErrorBudget(error_budget);
+    processed_orders.setErrorBudget(error_budget);
     for (IObjects* object : initial_objects)
     {
-        if (i < argc)
+        object->setErrorBudget(error_budget);
+        if (i < arguments.size())
         {
             // take app argument
-            filename = argv[i];
+            filename = arguments[i];
         }
         else
         {
@@ -40,16 +126,35 @@ int main(int argc, char* argv[])
         }
         i++;
 
+        // valid snapshot of previous run replaces CSV deserialization
+        if (object->loadSnapshot(filename))
+        {
+            std::cout << "Succesfully loaded " << object->getObjectType() << " snapshot." << std::endl;
+            continue;
+        }
+
         try
         {
-            // open file
-            csv_reader->open(filename);
+            if (num_threads == 1)
+            {
+                // open file
+                csv_reader->open(filename);
 
-            // deserialize
-            (*object) << csv_reader;
+                // deserialize
+                (*object) << csv_reader;
+            }
+            else
+            {
+                // deserialize on multiple threads
+                object->loadParallel(filename, num_threads);
+            }
 
-            // report success
+            // report success & skipped rows
             std::cout << "Succesfully processed " << object->getObjectType() << " data." << std::endl;
+            for (const RowError& error : object->getErrorReport().getErrors())
+            {
+                std::cerr << object->getObjectType() << " skipped row " << error.row << " -> " << error.reason << std::endl;
+            }
         }
         catch (const std::exception& e)
         {
@@ -57,6 +162,96 @@ int main(int argc, char* argv[])
             std::cerr << object->getObjectType() << " read failed -> " << e.what() << std::endl;
             return EXIT_FAILURE;
         }
+
+        try
+        {
+            // snapshot for the next start
+            object->saveSnapshot(filename);
+        }
+        catch (const std::exception& e)
+        {
+            // snapshot is optional, report warning only
+            std::cerr << object->getObjectType() << " snapshot write failed -> " << e.what() << std::endl;
+        }
+    }
+
+    if (!batch_path.empty())
+    {
+        std::vector<OrderBatchResult> results;
+        bool failed = false;
+        size_t num_rows = 0;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        std::vector<PipelineStageStats> stage_stats;
+        try
+        {
+            if (pipeline)
+            {
+                // parse, price & write orders of batch in overlapping stages
+                OrderPipeline order_pipeline(items, &discounts);
+                order_pipeline.setErrorBudget(error_budget);
+                order_pipeline.setBillSink(bill_sink);
+                results = order_pipeline.process(OrderBatch::listOrderFiles(batch_path), pipeline_config);
+                stage_stats = order_pipeline.getStageStats();
+            }
+            else if (num_in_flight)
+            {
+                // read orders & write bills asynchronously (io_uring or thread pool), price them meanwhile
+                OrderBatch batch(items, &discounts);
+                batch.setErrorBudget(error_budget);
+                batch.setBillSink(bill_sink);
+                results = batch.processAsync(OrderBatch::listOrderFiles(batch_path), num_threads, num_in_flight);
+                std::cout << "Asynchronous I/O on " << ((AsyncIo::isRingSupported()) ? "io_uring" : "thread pool") << std::endl;
+            }
+            else
+            {
+                // price every order of batch concurrently
+                OrderBatch batch(items, &discounts);
+                batch.setErrorBudget(error_budget);
+                batch.setBillSink(bill_sink);
+                results = batch.process(OrderBatch::listOrderFiles(batch_path), num_threads);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Batch failed -> " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // report every order in order of files
+        for (const OrderBatchResult& result : results)
+        {
+            num_rows += result.numOfRows;
+            if (!result.error.empty())
+            {
+                std::cerr << result.orderFilename << " read failed -> " << result.error << std::endl;
+                failed = true;
+                continue;
+            }
+            for (const RowError& error : result.skippedRows)
+            {
+                std::cerr << result.orderFilename << " skipped row " << error.row << " -> " << error.reason << std::endl;
+            }
+            std::cout << "Successfully processed order " << result.billFilename << std::endl;
+        }
+
+        // report throughput
+        std::cout << "Processed " << results.size() << " orders (" << num_rows << " lines) in " << seconds * 1000 << " ms: "
+                  << results.size() / seconds << " orders/s, " << num_rows / seconds << " lines/s" << std::endl;
+
+        // report stages, full input queue is in front of bottleneck
+        for (const PipelineStageStats& stage : stage_stats)
+        {
+            std::cout << "Stage " << stage.name << " (" << stage.numOfThreads << " threads): " << stage.numOfOrders << " orders, busy "
+                      << stage.busyMs << " ms, starved " << stage.starvedMs << " ms, blocked " << stage.blockedMs << " ms";
+            if (stage.queueCapacity)
+            {
+                std::cout << ", queue depth " << stage.meanQueueDepth << " avg / " << stage.maxQueueDepth << " max of " << stage.queueCapacity;
+            }
+            std::cout << std::endl;
+        }
+        return (failed) ? EXIT_FAILURE : EXIT_SUCCESS;
     }
 
     // endless loop for entering the orders
@@ -77,25 +272,41 @@ int main(int argc, char* argv[])
             // open file
             csv_reader->open(filename);
 
-            // deserialize
-            orders << csv_reader;
+            if (fused)
+            {
+                // generate processed_orders while rows are read
+                processed_orders.processOrder(*csv_reader, &items, &discounts);
+            }
+            else
+            {
+                // deserialize
+                orders << csv_reader;
+            }
 
-            // report success
+            // report success & skipped rows
             std::cout << "Succesfully processed " << orders.getObjectType() << " data." << std::endl;
+            const RowErrorReport& report = (fused) ? processed_orders.getErrorReport() : orders.getErrorReport();
+            for (const RowError& error : report.getErrors())
+            {
+                std::cerr << orders.getObjectType() << " skipped row " << error.row << " -> " << error.reason << std::endl;
+            }
 
-            // generate processed_orders
-            processed_orders.processOrder(&orders, &items, &discounts);
+            if (!fused)
+            {
+                // generate processed_orders
+                processed_orders.processOrder(&orders, &items, &discounts);
+            }
 
-            filename = "processed_order_" + std::to_string(processed_orders.getOrderNum()) + ".txt";
-            txt_writer.open(filename);
+            filename = bill_sink->getBillFilename(processed_orders.getOrderNum());
+            txt_writer.open(filename, bill_sink->getOpenMode());
 
             // write processed_orders
-            processed_orders >> txt_writer;
+            processed_orders.writeBill(txt_writer, *bill_sink);
 
             txt_writer.close();
 
             // report success
-            std::cout << "Successfully processed orderd " << filename << std::endl;
+            std::cout << "Successfully processed order " << filename << std::endl;
         }
         catch (const std::exception& e)
         {
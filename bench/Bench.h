@@ -0,0 +1,59 @@
+/**
+ * @file Bench.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Benchmark entry points & timing utilities
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @brief Measures wall time of callable
+ *
+ * @param[in] function - code to measure
+ * @return double - elapsed time in milliseconds
+ */
+inline double measureMs(const std::function<void()>& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/**
+ * @brief Generates valid, unique 13 digits long EAN
+ *
+ * @param[in] index - sequence number of EAN
+ * @return uint64_t - EAN 13 ID
+ */
+inline uint64_t generateEan13(uint64_t index)
+{
+    // multiplication with odd constant is bijection, so EANs stay unique
+    return 1000000000000ULL + (index * 2654435761ULL) % 9000000000000ULL;
+}
+
+/**
+ * @brief Compares startup time of CSV readers on items file
+ *        usage: reader <items.csv> <csv|mmap> [rows to generate]
+ */
+int readerBench(int argc, char* argv[]);
+/**
+ * @brief Compares EAN 13 lookup throughput of std::map & EanMap
+ *        usage: lookup [number of items...] (1M & 10M items by default)
+ */
+int lookupBench(int argc, char* argv[]);
+/**
+ * @brief Measures discount lookups & order processing where 90% of order lines have no discount
+ *        usage: order [number of order lines] (1M by default)
+ */
+int orderBench(int argc, char* argv[]);
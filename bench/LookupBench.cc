@@ -0,0 +1,145 @@
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+#include <objects/EanMap.h>
+#include <objects/Items.h>
+
+#include "Bench.h"
+
+#define LOOKUP_BENCH_RUNS 3
+#define LOOKUP_BENCH_LOOKUPS 10000000
+
+/**
+ * @brief Generates EANs to look up in random order, every other one is missing within collection
+ *
+ * @param[in] numOfItems - number of items within collection (EANs 0..numOfItems-1 of generateEan13)
+ * @return std::vector<uint64_t> - EANs to look up
+ */
+static std::vector<uint64_t> generateLookups(uint64_t numOfItems)
+{
+    std::vector<uint64_t> lookups(LOOKUP_BENCH_LOOKUPS);
+    uint64_t state = 88172645463325252ULL;
+
+    for (size_t i = 0; i < lookups.size(); i++)
+    {
+        // xorshift keeps order of lookups random, but the same for both collections
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        lookups[i] = generateEan13((i % 2) ? state % numOfItems : numOfItems + state % numOfItems);
+    }
+    return lookups;
+}
+
+/**
+ * @brief Measures best time of looking up every EAN within collection
+ *
+ * @param[in] lookups - EANs to look up
+ * @param[in] find - function which returns item of EAN or NULL
+ * @param[out] found - number of found items (keeps lookups from being optimized away)
+ * @return double - best time in milliseconds
+ */
+template <typename Find>
+static double measureLookups(const std::vector<uint64_t>& lookups, Find find, size_t& found)
+{
+    double best = 0;
+    for (int i = 0; i < LOOKUP_BENCH_RUNS; i++)
+    {
+        found = 0;
+        const double elapsed = measureMs([&]()
+        {
+            for (const uint64_t key : lookups)
+            {
+                found += (find(key) != nullptr);
+            }
+        });
+        best = (i == 0) ? elapsed : std::min(best, elapsed);
+    }
+    return best;
+}
+
+/**
+ * @brief Compares std::map with EanMap of items
+ *
+ * @param[in] numOfItems - number of items within collection
+ */
+static void compareCollections(uint64_t numOfItems)
+{
+    const std::vector<uint64_t> lookups = generateLookups(numOfItems);
+    const Item item = {"Item", Money::fromMinorUnits(125), Percent::fromMinorUnits(350)};
+    size_t mapFound;
+    size_t eanMapFound;
+    double mapBuildMs;
+    double eanMapBuildMs;
+    double mapMs;
+    double eanMapMs;
+
+    // one collection at a time keeps memory usage of 10M items reasonable
+    {
+        std::map<uint64_t, Item> map;
+        mapBuildMs = measureMs([&]()
+        {
+            for (uint64_t i = 0; i < numOfItems; i++)
+            {
+                map[generateEan13(i)] = item;
+            }
+        });
+        mapMs = measureLookups(lookups, [&](uint64_t key) -> const Item*
+        {
+            const auto it = map.find(key);
+            return (it != map.end()) ? &it->second : nullptr;
+        }, mapFound);
+    }
+    {
+        EanMap<Item> eanMap;
+        eanMapBuildMs = measureMs([&]()
+        {
+            for (uint64_t i = 0; i < numOfItems; i++)
+            {
+                eanMap[generateEan13(i)] = item;
+            }
+        });
+        eanMapMs = measureLookups(lookups, [&](uint64_t key)
+        {
+            return eanMap.find(key);
+        }, eanMapFound);
+    }
+
+    if (mapFound != eanMapFound)
+    {
+        std::cerr << "collections found different number of items" << std::endl;
+    }
+
+    std::cout << "items: " << numOfItems << ", lookups: " << lookups.size() << " (half of them missing)" << std::endl;
+    std::cout << "std::map build: " << mapBuildMs << " ms, lookups: " << mapMs << " ms (" << lookups.size() / (mapMs * 1000) << " M/s)" << std::endl;
+    std::cout << "EanMap   build: " << eanMapBuildMs << " ms, lookups: " << eanMapMs << " ms (" << lookups.size() / (eanMapMs * 1000) << " M/s)" << std::endl;
+}
+
+int lookupBench(int argc, char* argv[])
+{
+    std::vector<uint64_t> sizes;
+
+    for (int i = 1; i < argc; i++)
+    {
+        sizes.push_back(std::stoull(argv[i]));
+    }
+    if (sizes.empty())
+    {
+        sizes = {1000000, 10000000};
+    }
+
+    for (const uint64_t numOfItems : sizes)
+    {
+        if (numOfItems == 0)
+        {
+            std::cerr << "Usage: lookup [number of items...]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        compareCollections(numOfItems);
+    }
+    return EXIT_SUCCESS;
+}
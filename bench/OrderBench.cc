@@ -0,0 +1,279 @@
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+
+#include <objects/Items.h>
+#include <objects/Discounts.h>
+#include <objects/Orders.h>
+#include <objects/PricingKernel.h>
+#include <objects/ProcessedOrders.h>
+#include <file_reader/CsvReader.h>
+
+#include "Bench.h"
+
+#define ORDER_BENCH_RUNS 3
+/**
+ * @brief every n-th item has discount (90% of order lines have none)
+ */
+#define ORDER_BENCH_DISCOUNT_STEP 10
+/**
+ * @brief number of lines per item within order with repeated items
+ */
+#define ORDER_BENCH_REPEATS 10
+
+/**
+ * @brief Order line laid out like the ones of ProcessedOrders (structure per line)
+ */
+struct BenchLine
+{
+    uint64_t ean13;
+    std::string_view name;
+    ProcessedOrder order;
+};
+
+/**
+ * @brief Measures best time of function
+ *
+ * @param[in] function - code to measure
+ * @return double - best time in milliseconds
+ */
+static double measureBestMs(const std::function<void()>& function)
+{
+    double best = 0;
+    for (int i = 0; i < ORDER_BENCH_RUNS; i++)
+    {
+        const double elapsed = measureMs(function);
+        best = (i == 0) ? elapsed : std::min(best, elapsed);
+    }
+    return best;
+}
+
+/**
+ * @brief Writes CSV file & deserializes objects from it (file is removed afterwards)
+ *
+ * @param[out] objects - objects to deserialize
+ * @param[in] filename - CSV file
+ * @param[in] rows - number of rows
+ * @param[in] step - every step-th row is written
+ * @param[in] row - function which writes row of sequence number into stream
+ */
+static void load(IObjects& objects, const std::string& filename, uint64_t rows, uint64_t step, const std::function<void(std::ofstream&, uint64_t)>& row)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    std::ofstream writer(filename);
+
+    for (uint64_t i = 0; i < rows; i += step)
+    {
+        row(writer, i);
+    }
+    writer.close();
+
+    reader->open(filename);
+    objects << reader;
+    std::remove(filename.c_str());
+}
+
+int orderBench(int argc, char* argv[])
+{
+    const uint64_t numOfLines = (argc >= 2) ? std::stoull(argv[1]) : 1000000;
+    std::vector<uint64_t> keys;
+    std::map<uint64_t, float> discountMap;
+    Items items;
+    Discounts discounts;
+    Orders orders;
+    ProcessedOrders processedOrders;
+    size_t found = 0;
+
+    if (numOfLines == 0)
+    {
+        std::cerr << "Usage: order [number of order lines]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        // every order line has item, every 10th one has discount too
+        load(items, "bench_items.csv", numOfLines, 1, [](std::ofstream& writer, uint64_t i)
+        {
+            writer << generateEan13(i) << ";Item " << i << ";" << (i % 1000) << ".25;" << (i % 25) << "\n";
+        });
+        load(discounts, "bench_discounts.csv", numOfLines, ORDER_BENCH_DISCOUNT_STEP, [](std::ofstream& writer, uint64_t i)
+        {
+            writer << generateEan13(i) << ";" << (i % 50) << "\n";
+        });
+        load(orders, "bench_orders.csv", numOfLines, 1, [](std::ofstream& writer, uint64_t i)
+        {
+            writer << generateEan13(i) << ";" << (i % 7 + 1) << "\n";
+        });
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "order bench failed -> " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    for (uint64_t i = 0; i < numOfLines; i++)
+    {
+        keys.push_back(generateEan13(i));
+        if (i % ORDER_BENCH_DISCOUNT_STEP == 0)
+        {
+            discountMap[keys.back()] = static_cast<float>(i % 50);
+        }
+    }
+
+    // former discount lookup: std::map::at, missing discount unwinds
+    const double atMs = measureBestMs([&]()
+    {
+        for (const uint64_t key : keys)
+        {
+            try
+            {
+                found += discountMap.at(key) >= 0;
+            }
+            catch (...)
+            {
+            }
+        }
+    });
+    // find based lookup of the same map
+    const double findMs = measureBestMs([&]()
+    {
+        for (const uint64_t key : keys)
+        {
+            const auto it = discountMap.find(key);
+            found += it != discountMap.end();
+        }
+    });
+    // current discount lookup
+    const double getDiscountMs = measureBestMs([&]()
+    {
+        for (const uint64_t key : keys)
+        {
+            found += discounts.getDiscount(key) != nullptr;
+        }
+    });
+    // whole order, the first call builds price table
+    const double firstOrderMs = measureMs([&]()
+    {
+        processedOrders.processOrder(&orders, &items, &discounts);
+    });
+    const size_t warmUpstreamAllocations = processedOrders.getArena().getNumOfUpstreamAllocations();
+    const double orderMs = measureBestMs([&]()
+    {
+        processedOrders.processOrder(&orders, &items, &discounts);
+    });
+    const size_t orderAllocations = processedOrders.getArena().getNumOfAllocations();
+    const size_t orderUpstreamAllocations = processedOrders.getArena().getNumOfUpstreamAllocations() - warmUpstreamAllocations;
+
+    // order of the same size with every item repeated 10 times, repeats are summed up while loading
+    double repeatedLoadMs = 0;
+    double stagedMs = 0;
+    double fusedMs = 0;
+    double billMs = 0;
+    try
+    {
+        std::shared_ptr<CsvReader> reader(new CsvReader);
+        std::ofstream writer("bench_repeated_orders.csv");
+        for (uint64_t i = 0; i < numOfLines; i++)
+        {
+            writer << generateEan13(i % std::max<uint64_t>(1, numOfLines / ORDER_BENCH_REPEATS)) << ";1\n";
+        }
+        writer.close();
+
+        repeatedLoadMs = measureBestMs([&]()
+        {
+            reader->open("bench_repeated_orders.csv");
+            orders << reader;
+        });
+        // the same order through Orders & processOrder, then priced while it is read
+        stagedMs = measureBestMs([&]()
+        {
+            reader->open("bench_repeated_orders.csv");
+            orders << reader;
+            processedOrders.processOrder(&orders, &items, &discounts);
+        });
+        fusedMs = measureBestMs([&]()
+        {
+            reader->open("bench_repeated_orders.csv");
+            processedOrders.processOrder(*reader, &items, &discounts);
+        });
+        std::remove("bench_repeated_orders.csv");
+
+        // bill of the last order
+        billMs = measureBestMs([&]()
+        {
+            writer.open("bench_bill.txt");
+            processedOrders >> writer;
+            writer.close();
+        });
+        std::remove("bench_bill.txt");
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "order bench failed -> " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // pricing kernel alone on columns of order lines, every instruction set gives the same total
+    const PricingKernel::Isa initialIsa = PricingKernel::getIsa();
+    std::vector<int64_t> unitPrices(numOfLines);
+    std::vector<int64_t> quantities(numOfLines);
+    std::vector<int64_t> finalPrices(numOfLines);
+    std::vector<BenchLine> lines(numOfLines);
+    double kernelMs[3] = {};
+    int64_t kernelTotals[3] = {};
+    double linesMs[3] = {};
+    int64_t linesTotals[3] = {};
+    for (uint64_t i = 0; i < numOfLines; i++)
+    {
+        unitPrices[i] = static_cast<int64_t>((i % 1000) * 100 + 25);
+        quantities[i] = static_cast<int64_t>((i % 7 + 1) * 1000 + i % 1000);
+        lines[i].ean13 = generateEan13(i);
+        lines[i].order.unitPrice = Money::fromMinorUnits(unitPrices[i]);
+        lines[i].order.quantity = Quantity::fromMinorUnits(quantities[i]);
+    }
+    for (const PricingKernel::Isa isa : {PricingKernel::Isa::Scalar, PricingKernel::Isa::Avx2, PricingKernel::Isa::Avx512})
+    {
+        const int index = static_cast<int>(isa);
+        PricingKernel::setIsa(isa);
+        kernelMs[index] = measureBestMs([&]()
+        {
+            kernelTotals[index] = PricingKernel::priceLines(unitPrices.data(), quantities.data(), finalPrices.data(), numOfLines);
+        });
+
+        // the same lines kept as structures, as ProcessedOrders prices them (copies into columns & back included)
+        linesMs[index] = measureBestMs([&]()
+        {
+            linesTotals[index] = PricingKernel::priceOrders(lines.data(), numOfLines, [](BenchLine& line) -> ProcessedOrder& { return line.order; });
+        });
+    }
+    PricingKernel::setIsa(initialIsa);
+
+    std::cout << "order lines: " << numOfLines << ", with discount: " << discountMap.size() << " (lookup hits: " << found << ")" << std::endl;
+    std::cout << "std::map::at + catch:    " << atMs << " ms" << std::endl;
+    std::cout << "std::map::find:          " << findMs << " ms" << std::endl;
+    std::cout << "Discounts::getDiscount:  " << getDiscountMs << " ms" << std::endl;
+    std::cout << "processOrder (first):    " << firstOrderMs << " ms" << std::endl;
+    std::cout << "processOrder (repeated): " << orderMs << " ms" << std::endl;
+    std::cout << "processOrder arena:      " << orderAllocations << " allocations, "
+              << orderUpstreamAllocations << " upstream after the first order" << std::endl;
+    std::cout << "Orders load (repeats):   " << repeatedLoadMs << " ms" << std::endl;
+    std::cout << "Orders + processOrder:   " << stagedMs << " ms" << std::endl;
+    std::cout << "processOrder (fused):    " << fusedMs << " ms" << std::endl;
+    std::cout << "bill of fused order:     " << billMs << " ms" << std::endl;
+    std::cout << "pricing kernel scalar:   " << kernelMs[0] << " ms (total " << Money::fromMinorUnits(kernelTotals[0]) << ")" << std::endl;
+    std::cout << "pricing kernel AVX2:     " << kernelMs[1] << " ms (total " << Money::fromMinorUnits(kernelTotals[1]) << ")" << std::endl;
+    std::cout << "pricing kernel AVX-512:  " << kernelMs[2] << " ms (total " << Money::fromMinorUnits(kernelTotals[2]) << ")" << std::endl;
+    std::cout << "kernel on lines scalar:  " << linesMs[0] << " ms (total " << Money::fromMinorUnits(linesTotals[0]) << ")" << std::endl;
+    std::cout << "kernel on lines AVX2:    " << linesMs[1] << " ms (total " << Money::fromMinorUnits(linesTotals[1]) << ")" << std::endl;
+    std::cout << "kernel on lines AVX-512: " << linesMs[2] << " ms (total " << Money::fromMinorUnits(linesTotals[2]) << ")" << std::endl;
+    return EXIT_SUCCESS;
+}
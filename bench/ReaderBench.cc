@@ -0,0 +1,152 @@
+#include <iostream>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+#include <objects/Items.h>
+#include <file_reader/CsvReader.h>
+#include <file_reader/MmapCsvReader.h>
+
+#include "Bench.h"
+
+#define READER_BENCH_RUNS 3
+
+/**
+ * @brief Writes items CSV in the same layout as input/items.csv
+ *
+ * @param[in] filename - file to create
+ * @param[in] rows - number of rows
+ */
+static void generateItems(const std::string& filename, uint64_t rows)
+{
+    std::ofstream writer(filename);
+    for (uint64_t i = 0; i < rows; i++)
+    {
+        writer << generateEan13(i) << ";\tItem " << i << ";\t\t" << (i % 1000) << "." << (i % 100) << ";\t\t" << (i % 25) << "\n";
+    }
+}
+
+/**
+ * @brief Measures time of items deserialization with particular reader
+ *
+ * @param[in] reader - reader to measure
+ * @param[in] filename - items CSV
+ * @return double - time in milliseconds
+ */
+static double measureItems(std::shared_ptr<IFileReader> reader, const std::string& filename)
+{
+    Items items;
+    const double elapsed = measureMs([&]()
+    {
+        reader->open(filename);
+        items << reader;
+    });
+
+    // snapshot for measureSnapshot
+    items.saveSnapshot(filename);
+    return elapsed;
+}
+
+/**
+ * @brief Measures time of items snapshot mapping (snapshot is removed afterwards)
+ *
+ * @param[in] filename - items CSV
+ * @return double - time in milliseconds
+ */
+static double measureSnapshot(const std::string& filename)
+{
+    Items items;
+    bool loaded = false;
+    const double elapsed = measureMs([&]()
+    {
+        loaded = items.loadSnapshot(filename);
+    });
+
+    items.loadSnapshot("");
+    std::remove((filename + SNAPSHOT_EXTENSION).c_str());
+    if (!loaded)
+    {
+        throw std::runtime_error("Snapshot of " + filename + " is not valid");
+    }
+    return elapsed;
+}
+
+/**
+ * @brief Measures best time of walking all rows with particular reader (without cell parsing)
+ *
+ * @param[in] reader - reader to measure
+ * @param[in] filename - items CSV
+ * @return double - best time in milliseconds
+ */
+static double measureRows(std::shared_ptr<IFileReader> reader, const std::string& filename)
+{
+    double best = 0;
+    for (int i = 0; i < READER_BENCH_RUNS; i++)
+    {
+        const double elapsed = measureMs([&]()
+        {
+            reader->open(filename);
+            while (reader->read());
+        });
+        best = (i == 0) ? elapsed : std::min(best, elapsed);
+    }
+    return best;
+}
+
+int readerBench(int argc, char* argv[])
+{
+    std::shared_ptr<IFileReader> reader;
+
+    if (argc < 3)
+    {
+        std::cerr << "Usage: reader <items.csv> <csv|mmap> [rows to generate]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string filename = argv[1];
+    const std::string readerName = argv[2];
+    if (readerName == "csv")
+    {
+        reader = std::make_shared<CsvReader>();
+    }
+    else if (readerName == "mmap")
+    {
+        reader = std::make_shared<MmapCsvReader>();
+    }
+    else
+    {
+        std::cerr << "Unknown reader " << readerName << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (argc >= 4)
+    {
+        generateItems(filename, std::stoull(argv[3]));
+    }
+
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    const double megabytes = static_cast<double>(file.tellg()) / (1024 * 1024);
+
+    try
+    {
+        // row walk also warms up page cache, so startup measures parsing only
+        const double rowsMs = measureRows(reader, filename);
+        // startup is single load within fresh process (run bench once per reader)
+        const double itemsMs = measureItems(reader, filename);
+        const double snapshotMs = measureSnapshot(filename);
+
+        std::cout << "items file: " << megabytes << " MiB, reader: " << readerName << std::endl;
+        std::cout << "rows only: " << rowsMs << " ms (" << megabytes * 1000 / rowsMs << " MiB/s)" << std::endl;
+        std::cout << "Items <<:  " << itemsMs << " ms (" << megabytes * 1000 / itemsMs << " MiB/s)" << std::endl;
+        std::cout << "snapshot:  " << snapshotMs << " ms" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "reader bench failed -> " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
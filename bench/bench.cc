@@ -0,0 +1,40 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include "Bench.h"
+
+// argv[1] shall be name of benchmark, rest of arguments are passed to it
+int main(int argc, char* argv[])
+{
+    const struct
+    {
+        const char* name;
+        int (*run)(int, char*[]);
+    } benches[] =
+    {
+        {"reader", readerBench},
+        {"lookup", lookupBench},
+        {"order", orderBench},
+    };
+
+    if (argc >= 2)
+    {
+        for (const auto& bench : benches)
+        {
+            if (!std::strcmp(argv[1], bench.name))
+            {
+                return bench.run(argc - 1, argv + 1);
+            }
+        }
+    }
+
+    std::cerr << "Usage: " << argv[0] << " <benchmark> [arguments]" << std::endl;
+    std::cerr << "Benchmarks:";
+    for (const auto& bench : benches)
+    {
+        std::cerr << " " << bench.name;
+    }
+    std::cerr << std::endl;
+    return EXIT_FAILURE;
+}
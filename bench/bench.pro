@@ -0,0 +1,16 @@
+TEMPLATE = app
+
+CONFIG += thread
+
+TARGET = AmazingShopBench
+
+HEADERS += Bench.h
+
+SOURCES += bench.cc
+SOURCES += ReaderBench.cc
+SOURCES += LookupBench.cc
+SOURCES += OrderBench.cc
+
+LIBS += -L$$OUT_PWD/../lib -lAmazingAPI
+
+INCLUDEPATH += $$PWD/../lib
@@ -0,0 +1,84 @@
+/**
+ * @file BinaryBill.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief BinaryBillHeader & BinaryBillRecord structures (binary bill file format)
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief magic of binary bill file (including terminating zero)
+ */
+#define BINARY_BILL_MAGIC "AOSBILL"
+#define BINARY_BILL_MAGIC_LEN 8
+/**
+ * @brief version of file format, written in host byte order, so file of other byte order is rejected too
+ */
+#define BINARY_BILL_VERSION 1
+/**
+ * @brief number of name bytes within record (longer names are cut, shorter ones are zero padded)
+ */
+#define BINARY_BILL_NAME_LEN 24
+
+/**
+ * @brief Header of binary bill file, followed by numOfRecords records.
+ *        Every value is kept in minor units of its fixed point type (see FixedPoint.h).
+ */
+struct BinaryBillHeader
+{
+    char magic[BINARY_BILL_MAGIC_LEN];
+    uint32_t version;
+    /**
+     * @brief size of single record in bytes
+     */
+    uint32_t recordSize;
+    uint64_t orderNum;
+    uint64_t numOfRecords;
+    /**
+     * @brief total price in cents
+     */
+    int64_t total;
+};
+
+/**
+ * @brief Fixed width record of single bill line, records are sorted by item name (same as text bill)
+ */
+struct BinaryBillRecord
+{
+    uint64_t ean13;
+    /**
+     * @brief unit price in cents
+     */
+    int64_t unitPrice;
+    /**
+     * @brief quantity in thousandths of unit
+     */
+    int64_t quantity;
+    /**
+     * @brief final price in cents
+     */
+    int64_t finalPrice;
+    /**
+     * @brief tax percent in hundredths of percent
+     */
+    int32_t taxPercent;
+    /**
+     * @brief discount percent in hundredths of percent
+     */
+    int32_t discountPercent;
+    /**
+     * @brief item name, zero padded (not terminated if it fills the field)
+     */
+    char name[BINARY_BILL_NAME_LEN];
+};
+
+static_assert(sizeof(BinaryBillHeader) == 40 && std::is_trivially_copyable_v<BinaryBillHeader>, "binary bill header isn't packed");
+static_assert(sizeof(BinaryBillRecord) == 64 && std::is_trivially_copyable_v<BinaryBillRecord>, "binary bill record isn't packed");
@@ -0,0 +1,66 @@
+#include <cstring>
+#include <stdexcept>
+
+#include "BinaryBillReader.h"
+
+void BinaryBillReader::open(const std::string& filename) noexcept(false)
+{
+    mHeader = nullptr;
+    mFile.open(filename);
+
+    // validate header & size of file
+    const BinaryBillHeader* header = reinterpret_cast<const BinaryBillHeader*>(mFile.data());
+    if (mFile.size() < sizeof(BinaryBillHeader) || std::memcmp(header->magic, BINARY_BILL_MAGIC, BINARY_BILL_MAGIC_LEN) != 0)
+    {
+        mFile.close();
+        throw std::runtime_error("Bad format of binary bill " + filename);
+    }
+    if (header->version != BINARY_BILL_VERSION || header->recordSize != sizeof(BinaryBillRecord))
+    {
+        mFile.close();
+        throw std::runtime_error("Unsupported version of binary bill " + filename);
+    }
+    if ((mFile.size() - sizeof(BinaryBillHeader)) / sizeof(BinaryBillRecord) != header->numOfRecords ||
+        (mFile.size() - sizeof(BinaryBillHeader)) % sizeof(BinaryBillRecord) != 0)
+    {
+        mFile.close();
+        throw std::runtime_error("Truncated binary bill " + filename);
+    }
+    mHeader = header;
+}
+
+const BinaryBillHeader& BinaryBillReader::getHeader() const noexcept(false)
+{
+    if (!mHeader)
+    {
+        throw std::runtime_error("Can't read bill because file is not opened.");
+    }
+    return *mHeader;
+}
+
+std::span<const BinaryBillRecord> BinaryBillReader::getRecords() const noexcept(false)
+{
+    // records follow header (mapping is page aligned, header keeps records 8 bytes aligned)
+    const BinaryBillHeader& header = this->getHeader();
+    return std::span<const BinaryBillRecord>(reinterpret_cast<const BinaryBillRecord*>(&header + 1), header.numOfRecords);
+}
+
+BillLine BinaryBillReader::getLine(size_t index) const noexcept(false)
+{
+    const std::span<const BinaryBillRecord> records = this->getRecords();
+    if (index >= records.size())
+    {
+        throw std::out_of_range("Record " + std::to_string(index) + " is beyond binary bill.");
+    }
+
+    const BinaryBillRecord& record = records[index];
+    BillLine line;
+    line.ean13 = record.ean13;
+    line.name = std::string_view(record.name, strnlen(record.name, BINARY_BILL_NAME_LEN));
+    line.taxPercent = Percent::fromMinorUnits(record.taxPercent);
+    line.discountPercent = Percent::fromMinorUnits(record.discountPercent);
+    line.unitPrice = Money::fromMinorUnits(record.unitPrice);
+    line.quantity = Quantity::fromMinorUnits(record.quantity);
+    line.finalPrice = Money::fromMinorUnits(record.finalPrice);
+    return line;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file BinaryBillReader.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief BinaryBillReader class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <span>
+#include <string>
+
+#include "IBillSink.h"
+#include "BinaryBill.h"
+#include "file_reader/MappedFile.h"
+
+/**
+ * @brief Binary Bill Reader class
+ *        maps binary bill file (see BinaryBillSink) & gives its records in place, without parsing or copying them
+ */
+class BinaryBillReader
+{
+public:
+    /**
+     * @brief Construct a new BinaryBillReader object
+     */
+    explicit BinaryBillReader() = default;
+    /**
+     * @brief Destroy the BinaryBillReader object (unmaps file)
+     */
+    ~BinaryBillReader() = default;
+
+    /**
+     * @brief Method which maps file & validates its header
+     *
+     * @exception std::runtime_error if file can't be mapped or it isn't binary bill of this format & byte order
+     *
+     * @param[in] filename - binary bill file
+     */
+    void open(const std::string& filename) noexcept(false);
+
+    /**
+     * @brief Get the header of bill
+     *
+     * @exception std::runtime_error if file is not opened
+     */
+    const BinaryBillHeader& getHeader() const noexcept(false);
+    /**
+     * @brief Get the records of bill (valid until file is reopened or reader is destroyed)
+     *
+     * @exception std::runtime_error if file is not opened
+     */
+    std::span<const BinaryBillRecord> getRecords() const noexcept(false);
+    /**
+     * @brief Get the record converted into bill line
+     *
+     * @exception std::out_of_range if index is beyond records
+     *
+     * @param[in] index - index of record
+     * @return BillLine - line of bill, name views record
+     */
+    BillLine getLine(size_t index) const noexcept(false);
+private:
+    /**
+     * @brief mapped file
+     */
+    MappedFile mFile;
+    /**
+     * @brief header within mapped file (NULL if file is not opened)
+     */
+    const BinaryBillHeader* mHeader = nullptr;
+};
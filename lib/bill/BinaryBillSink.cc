@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <cstring>
+
+#include "BinaryBillSink.h"
+
+const char* BinaryBillSink::getExtension() const
+{
+    return "bin";
+}
+
+std::ios_base::openmode BinaryBillSink::getOpenMode() const
+{
+    return std::ios::out | std::ios::binary;
+}
+
+size_t BinaryBillSink::getMaxLength(const BillSummary&) const
+{
+    return sizeof(BinaryBillHeader);
+}
+
+size_t BinaryBillSink::getMaxLength(const BillLine&) const
+{
+    return sizeof(BinaryBillRecord);
+}
+
+char* BinaryBillSink::writeHeader(char* out, const BillSummary& summary) const
+{
+    BinaryBillHeader header = {};
+
+    std::memcpy(header.magic, BINARY_BILL_MAGIC, BINARY_BILL_MAGIC_LEN);
+    header.version = BINARY_BILL_VERSION;
+    header.recordSize = sizeof(BinaryBillRecord);
+    header.orderNum = summary.orderNum;
+    header.numOfRecords = summary.numOfLines;
+    header.total = summary.total.getMinorUnits();
+
+    // buffer isn't aligned to header
+    std::memcpy(out, &header, sizeof(header));
+    return out + sizeof(header);
+}
+
+char* BinaryBillSink::writeLine(char* out, const BillSummary&, const BillLine& line) const
+{
+    BinaryBillRecord record = {};
+
+    record.ean13 = line.ean13;
+    record.unitPrice = line.unitPrice.getMinorUnits();
+    record.quantity = line.quantity.getMinorUnits();
+    record.finalPrice = line.finalPrice.getMinorUnits();
+    record.taxPercent = static_cast<int32_t>(line.taxPercent.getMinorUnits());
+    record.discountPercent = static_cast<int32_t>(line.discountPercent.getMinorUnits());
+    std::copy_n(line.name.data(), std::min<size_t>(line.name.length(), BINARY_BILL_NAME_LEN), record.name);
+
+    std::memcpy(out, &record, sizeof(record));
+    return out + sizeof(record);
+}
+
+char* BinaryBillSink::writeFooter(char* out, const BillSummary&) const
+{
+    // records are counted within header
+    return out;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file BinaryBillSink.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief BinaryBillSink class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "IBillSink.h"
+#include "BinaryBill.h"
+
+/**
+ * @brief Binary Bill Sink class
+ *        formats bill as header followed by fixed width records (see BinaryBill.h),
+ *        so file can be mapped & its records accessed in place (see BinaryBillReader)
+ */
+class BinaryBillSink : public IBillSink
+{
+public:
+    /**
+     * @brief Construct a new BinaryBillSink object
+     */
+    explicit BinaryBillSink() = default;
+    /**
+     * @brief Destroy the BinaryBillSink object
+     */
+    ~BinaryBillSink() = default;
+
+    const char* getExtension() const override;
+    std::ios_base::openmode getOpenMode() const override;
+    size_t getMaxLength(const BillSummary& summary) const override;
+    size_t getMaxLength(const BillLine& line) const override;
+    char* writeHeader(char* out, const BillSummary& summary) const override;
+    char* writeLine(char* out, const BillSummary& summary, const BillLine& line) const override;
+    char* writeFooter(char* out, const BillSummary& summary) const override;
+};
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <charconv>
+
+#include "CsvBillSink.h"
+
+#define CSV_DELIMITER ';'
+#define CSV_QUOTE '"'
+#define CSV_HEADER "order;ean13;name;tax;discount;unit_price;quantity;price\n"
+/**
+ * @brief the longest row apart from name (order number, EAN 13, numbers, delimiters & newline)
+ */
+#define CSV_ROW_MAX_LEN (2 * 20 + 5 * FIXED_POINT_MAX_LEN + 8)
+
+/**
+ * @brief Function which appends cell & its delimiter
+ *
+ * @param[out] out - buffer of bill
+ * @param[in] number - value of cell, with every fraction digit of its type
+ * @return char* - end of cell within buffer
+ */
+template <typename T>
+static char* appendCell(char* out, T number);
+
+const char* CsvBillSink::getExtension() const
+{
+    return "csv";
+}
+
+size_t CsvBillSink::getMaxLength(const BillSummary&) const
+{
+    return sizeof(CSV_HEADER) - 1;
+}
+
+size_t CsvBillSink::getMaxLength(const BillLine& line) const
+{
+    // every character of name may be doubled quote
+    return CSV_ROW_MAX_LEN + 2 * line.name.length() + 2;
+}
+
+char* CsvBillSink::writeHeader(char* out, const BillSummary&) const
+{
+    return std::copy_n(CSV_HEADER, sizeof(CSV_HEADER) - 1, out);
+}
+
+char* CsvBillSink::writeLine(char* out, const BillSummary& summary, const BillLine& line) const
+{
+    out = std::to_chars(out, out + 20, summary.orderNum).ptr;
+    *out++ = CSV_DELIMITER;
+    out = std::to_chars(out, out + 20, line.ean13).ptr;
+    *out++ = CSV_DELIMITER;
+
+    // quote name only if it can't be read back otherwise
+    if (line.name.find_first_of(";\"\r\n") == std::string_view::npos)
+    {
+        out = std::copy(line.name.begin(), line.name.end(), out);
+    }
+    else
+    {
+        *out++ = CSV_QUOTE;
+        for (const char c : line.name)
+        {
+            if (c == CSV_QUOTE)
+            {
+                *out++ = CSV_QUOTE;
+            }
+            *out++ = c;
+        }
+        *out++ = CSV_QUOTE;
+    }
+    *out++ = CSV_DELIMITER;
+
+    out = appendCell(out, line.taxPercent);
+    out = appendCell(out, line.discountPercent);
+    out = appendCell(out, line.unitPrice);
+    out = appendCell(out, line.quantity);
+    out = line.finalPrice.toChars(out);
+    *out++ = '\n';
+    return out;
+}
+
+char* CsvBillSink::writeFooter(char* out, const BillSummary&) const
+{
+    // total is sum of prices, rows stay uniform
+    return out;
+}
+
+template <typename T>
+static char* appendCell(char* out, T number)
+{
+    out = number.toChars(out);
+    *out++ = CSV_DELIMITER;
+    return out;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file CsvBillSink.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief CsvBillSink class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "IBillSink.h"
+
+/**
+ * @brief CSV Bill Sink class
+ *        formats bill as semicolon delimited rows with header row, one row per line of bill.
+ *        Numbers keep every fraction digit of their type, names are quoted only if they contain delimiter or quote
+ */
+class CsvBillSink : public IBillSink
+{
+public:
+    /**
+     * @brief Construct a new CsvBillSink object
+     */
+    explicit CsvBillSink() = default;
+    /**
+     * @brief Destroy the CsvBillSink object
+     */
+    ~CsvBillSink() = default;
+
+    const char* getExtension() const override;
+    size_t getMaxLength(const BillSummary& summary) const override;
+    size_t getMaxLength(const BillLine& line) const override;
+    char* writeHeader(char* out, const BillSummary& summary) const override;
+    char* writeLine(char* out, const BillSummary& summary, const BillLine& line) const override;
+    char* writeFooter(char* out, const BillSummary& summary) const override;
+};
@@ -0,0 +1,40 @@
+#include <stdexcept>
+
+#include "IBillSink.h"
+#include "TextBillSink.h"
+#include "CsvBillSink.h"
+#include "JsonLinesBillSink.h"
+#include "BinaryBillSink.h"
+
+#define BILL_FILENAME_PREFIX "processed_order_"
+
+std::ios_base::openmode IBillSink::getOpenMode() const
+{
+    return std::ios::out;
+}
+
+std::string IBillSink::getBillFilename(size_t orderNum) const
+{
+    return BILL_FILENAME_PREFIX + std::to_string(orderNum) + "." + this->getExtension();
+}
+
+std::shared_ptr<const IBillSink> IBillSink::create(std::string_view format) noexcept(false)
+{
+    if (format == "text")
+    {
+        return std::make_shared<TextBillSink>();
+    }
+    else if (format == "csv")
+    {
+        return std::make_shared<CsvBillSink>();
+    }
+    else if (format == "jsonl")
+    {
+        return std::make_shared<JsonLinesBillSink>();
+    }
+    else if (format == "binary")
+    {
+        return std::make_shared<BinaryBillSink>();
+    }
+    throw std::runtime_error("Unknown bill format " + std::string(format));
+}
@@ -0,0 +1,133 @@
+/**
+ * @file IBillSink.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief BillLine & BillSummary structures, IBillSink interface definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <ios>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "objects/FixedPoint.h"
+
+/**
+ * @brief Single line of bill (processed order of single item)
+ */
+struct BillLine
+{
+    /**
+     * @brief EAN 13 ID of item
+     */
+    uint64_t ean13 = 0;
+    /**
+     * @brief view of item name
+     */
+    std::string_view name;
+    Percent taxPercent;
+    Percent discountPercent;
+    Money unitPrice;
+    Quantity quantity;
+    /**
+     * @brief final price (including quantity)
+     */
+    Money finalPrice;
+};
+
+/**
+ * @brief Values of whole bill, known before its lines are written
+ */
+struct BillSummary
+{
+    size_t orderNum = 0;
+    size_t numOfLines = 0;
+    Money total;
+};
+
+/**
+ * @brief Bill Sink Interface class
+ *        formats bill (header, lines sorted by item name & footer) into buffer which is written at once.
+ *        Buffer is sized up front from maximal lengths, so sink never checks space.
+ *        Sinks are stateless, so single sink may be shared by many threads.
+ */
+class IBillSink
+{
+public:
+    /**
+     * @brief Construct a new IBillSink object
+     */
+    explicit IBillSink() = default;
+    /**
+     * @brief Destroy the IBillSink object
+     */
+    virtual ~IBillSink() = default;
+
+    /**
+     * @brief Get the extension of bill file (without dot)
+     */
+    virtual const char* getExtension() const = 0;
+    /**
+     * @brief Get the mode of bill file stream
+     */
+    virtual std::ios_base::openmode getOpenMode() const;
+    /**
+     * @brief Get the maximal length of header & footer together
+     */
+    virtual size_t getMaxLength(const BillSummary& summary) const = 0;
+    /**
+     * @brief Get the maximal length of line
+     */
+    virtual size_t getMaxLength(const BillLine& line) const = 0;
+
+    /**
+     * @brief Method which formats header of bill
+     *
+     * @param[out] out - buffer of bill
+     * @param[in] summary - values of whole bill
+     * @return char* - end of header within buffer
+     */
+    virtual char* writeHeader(char* out, const BillSummary& summary) const = 0;
+    /**
+     * @brief Method which formats line of bill
+     *
+     * @param[out] out - buffer of bill
+     * @param[in] summary - values of whole bill
+     * @param[in] line - line of bill
+     * @return char* - end of line within buffer
+     */
+    virtual char* writeLine(char* out, const BillSummary& summary, const BillLine& line) const = 0;
+    /**
+     * @brief Method which formats footer of bill
+     *
+     * @param[out] out - buffer of bill
+     * @param[in] summary - values of whole bill
+     * @return char* - end of footer within buffer
+     */
+    virtual char* writeFooter(char* out, const BillSummary& summary) const = 0;
+
+    /**
+     * @brief Get the bill filename of order
+     *
+     * @param[in] orderNum - order number
+     * @return std::string - processed_order_<order num>.<extension>
+     */
+    std::string getBillFilename(size_t orderNum) const;
+
+    /**
+     * @brief Creates sink of bill format
+     *
+     * @exception std::runtime_error if format is unknown
+     *
+     * @param[in] format - "text" (table), "csv" (semicolon delimited), "jsonl" (JSON Lines) or "binary" (fixed width records)
+     * @return std::shared_ptr<const IBillSink> - sink of format
+     */
+    static std::shared_ptr<const IBillSink> create(std::string_view format) noexcept(false);
+};
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <charconv>
+
+#include "JsonLinesBillSink.h"
+
+/**
+ * @brief the longest line apart from name (keys, order number, EAN 13 & numbers)
+ */
+#define JSONL_LINE_MAX_LEN (128 + 2 * 20 + 5 * FIXED_POINT_MAX_LEN)
+/**
+ * @brief the longest escaped character of name (i.e. "\u001f")
+ */
+#define JSONL_ESCAPE_MAX_LEN 6
+
+/**
+ * @brief Function which appends key & value of JSON object
+ *
+ * @param[out] out - buffer of bill
+ * @param[in] key - key including quotes & colon (i.e. ",\"tax\":")
+ * @param[in] number - value, with every fraction digit of its type
+ * @return char* - end of value within buffer
+ */
+template <typename T>
+static char* appendNumber(char* out, std::string_view key, T number);
+/**
+ * @brief Function which appends key & integer value of JSON object
+ */
+static char* appendInteger(char* out, std::string_view key, uint64_t number);
+
+const char* JsonLinesBillSink::getExtension() const
+{
+    return "jsonl";
+}
+
+size_t JsonLinesBillSink::getMaxLength(const BillSummary&) const
+{
+    return JSONL_LINE_MAX_LEN;
+}
+
+size_t JsonLinesBillSink::getMaxLength(const BillLine& line) const
+{
+    return JSONL_LINE_MAX_LEN + JSONL_ESCAPE_MAX_LEN * line.name.length();
+}
+
+char* JsonLinesBillSink::writeHeader(char* out, const BillSummary&) const
+{
+    // every line is self-contained object
+    return out;
+}
+
+char* JsonLinesBillSink::writeLine(char* out, const BillSummary& summary, const BillLine& line) const
+{
+    out = appendInteger(out, "{\"order\":", summary.orderNum);
+    out = appendInteger(out, ",\"ean13\":", line.ean13);
+
+    // escape quotes, backslashes & control characters of name
+    out = std::copy_n(",\"name\":\"", 9, out);
+    for (const char c : line.name)
+    {
+        const unsigned char byte = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\')
+        {
+            *out++ = '\\';
+            *out++ = c;
+        }
+        else if (byte < 0x20)
+        {
+            static constexpr char hex[] = "0123456789abcdef";
+            out = std::copy_n("\\u00", 4, out);
+            *out++ = hex[byte >> 4];
+            *out++ = hex[byte & 0xf];
+        }
+        else
+        {
+            *out++ = c;
+        }
+    }
+    *out++ = '"';
+
+    out = appendNumber(out, ",\"tax\":", line.taxPercent);
+    out = appendNumber(out, ",\"discount\":", line.discountPercent);
+    out = appendNumber(out, ",\"unitPrice\":", line.unitPrice);
+    out = appendNumber(out, ",\"quantity\":", line.quantity);
+    out = appendNumber(out, ",\"price\":", line.finalPrice);
+    out = std::copy_n("}\n", 2, out);
+    return out;
+}
+
+char* JsonLinesBillSink::writeFooter(char* out, const BillSummary& summary) const
+{
+    // summary object of order
+    out = appendInteger(out, "{\"order\":", summary.orderNum);
+    out = appendInteger(out, ",\"lines\":", summary.numOfLines);
+    out = appendNumber(out, ",\"total\":", summary.total);
+    out = std::copy_n("}\n", 2, out);
+    return out;
+}
+
+template <typename T>
+static char* appendNumber(char* out, std::string_view key, T number)
+{
+    out = std::copy(key.begin(), key.end(), out);
+    return number.toChars(out);
+}
+
+static char* appendInteger(char* out, std::string_view key, uint64_t number)
+{
+    out = std::copy(key.begin(), key.end(), out);
+    return std::to_chars(out, out + 20, number).ptr;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file JsonLinesBillSink.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief JsonLinesBillSink class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "IBillSink.h"
+
+/**
+ * @brief JSON Lines Bill Sink class
+ *        formats bill as one JSON object per line of bill, followed by summary object with number of lines & total.
+ *        Numbers are exact decimal JSON numbers with every fraction digit of their type
+ */
+class JsonLinesBillSink : public IBillSink
+{
+public:
+    /**
+     * @brief Construct a new JsonLinesBillSink object
+     */
+    explicit JsonLinesBillSink() = default;
+    /**
+     * @brief Destroy the JsonLinesBillSink object
+     */
+    ~JsonLinesBillSink() = default;
+
+    const char* getExtension() const override;
+    size_t getMaxLength(const BillSummary& summary) const override;
+    size_t getMaxLength(const BillLine& line) const override;
+    char* writeHeader(char* out, const BillSummary& summary) const override;
+    char* writeLine(char* out, const BillSummary& summary, const BillLine& line) const override;
+    char* writeFooter(char* out, const BillSummary& summary) const override;
+};
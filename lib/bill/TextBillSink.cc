@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+#include "TextBillSink.h"
+
+#define BILL_DIGITS 2 /* i.e. ".00" */
+#define COLS_MIN_DISTANCE 5
+#define PROD_NAME_MAX_LEN 20
+#define PERCENT_MAX_LEN 6
+#define PRICE_MAX_LEN 9
+#define AMOUNT_MAX_LEN 9
+/**
+ * @brief position of vertical bar within padding of column
+ */
+#define BILL_BAR_POS 2
+/**
+ * @brief the longest line of bill (cells longer than their columns push following ones right)
+ */
+#define BILL_LINE_MAX_LEN (PROD_NAME_MAX_LEN + 5 * (COLS_MIN_DISTANCE + PRICE_MAX_LEN + FIXED_POINT_MAX_LEN) + 1)
+#define BILL_SEPARATOR "------------------------------------------------------------------------------------\n"
+
+/**
+ * @brief Header of bill table (below order number)
+ */
+static constexpr std::string_view BILL_HEADER =
+    BILL_SEPARATOR
+    "Name                  |     Tax  |   Disc.  |    U.price  |     Quant.  |      Price\n"
+    BILL_SEPARATOR;
+
+/**
+ * @brief Function which formats number into cell aligned right within column,
+ *        padding of column starts with vertical bar (optionally, if padding is long enough)
+ *
+ * @param[out] out - buffer of bill
+ * @param[in] number - value of cell
+ * @param[in] width - width of column (padding & cell)
+ * @param[in] verticalBar - true if padding contains vertical bar
+ * @return char* - end of cell within buffer
+ */
+template <typename T>
+static char* formatCell(char* out, T number, size_t width, bool verticalBar = true);
+
+const char* TextBillSink::getExtension() const
+{
+    return "txt";
+}
+
+size_t TextBillSink::getMaxLength(const BillSummary&) const
+{
+    return 2 * BILL_LINE_MAX_LEN + BILL_HEADER.length();
+}
+
+size_t TextBillSink::getMaxLength(const BillLine&) const
+{
+    return BILL_LINE_MAX_LEN;
+}
+
+/**
+* Name            Tax   Disc.  U.price  Quant.  Price
+* ---------------------------------------------------
+* Fairy Dust	  8.80 	 0.00     4.99   3.00   14,97
+* Helping Hand	 12.00 	30.00   699.99   1.00  489.99
+* Freezing Coat  12.00 	15.00   124.99   1.00   87.49
+* ---------------------------------------------------
+* Total                                        592.45
+**/
+char* TextBillSink::writeHeader(char* out, const BillSummary& summary) const
+{
+    // enter table header
+    std::memcpy(out, "Order #", 7);
+    out = std::to_chars(out + 7, out + BILL_LINE_MAX_LEN, summary.orderNum).ptr;
+    *out++ = '\n';
+    return std::copy(BILL_HEADER.begin(), BILL_HEADER.end(), out);
+}
+
+char* TextBillSink::writeLine(char* out, const BillSummary&, const BillLine& line) const
+{
+    // if name has length bigger than 20 make it shorter
+    // i.e. "Very Long Name Of Prodcut" => "Very Long Name Of..."
+    if (line.name.length() > PROD_NAME_MAX_LEN)
+    {
+        out = std::copy_n(line.name.data(), PROD_NAME_MAX_LEN - 3, out);
+        out = std::copy_n("...", 3, out);
+    }
+    else
+    {
+        // pad item name to its column
+        out = std::copy(line.name.begin(), line.name.end(), out);
+        out = std::fill_n(out, PROD_NAME_MAX_LEN - line.name.length(), ' ');
+    }
+
+    // append item tax percent, discount percent, price wo discount, quantity & final price
+    out = formatCell(out, line.taxPercent, COLS_MIN_DISTANCE + PERCENT_MAX_LEN);
+    out = formatCell(out, line.discountPercent, COLS_MIN_DISTANCE + PERCENT_MAX_LEN);
+    out = formatCell(out, line.unitPrice, COLS_MIN_DISTANCE + PRICE_MAX_LEN);
+    out = formatCell(out, line.quantity, COLS_MIN_DISTANCE + AMOUNT_MAX_LEN);
+    out = formatCell(out, line.finalPrice, COLS_MIN_DISTANCE + PRICE_MAX_LEN);
+    *out++ = '\n';
+    return out;
+}
+
+char* TextBillSink::writeFooter(char* out, const BillSummary& summary) const
+{
+    // write total price
+    out = std::copy_n(BILL_SEPARATOR "Total", sizeof(BILL_SEPARATOR "Total") - 1, out);
+    return formatCell(out, summary.total, 70 + PRICE_MAX_LEN, false);
+}
+
+template <typename T>
+static char* formatCell(char* out, T number, size_t width, bool verticalBar)
+{
+    char cell[FIXED_POINT_MAX_LEN];
+    const size_t length = static_cast<size_t>(number.toChars(cell, BILL_DIGITS) - cell);
+
+    // cell longer than column has no padding
+    const size_t padding = (width > length) ? width - length : 0;
+    std::memset(out, ' ', padding);
+    if (verticalBar && BILL_BAR_POS < padding)
+    {
+        out[BILL_BAR_POS] = '|';
+    }
+    return std::copy_n(cell, length, out + padding);
+}
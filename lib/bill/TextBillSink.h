@@ -0,0 +1,38 @@
+/**
+ * @file TextBillSink.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief TextBillSink class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include "IBillSink.h"
+
+/**
+ * @brief Text Bill Sink class
+ *        formats bill as table aligned to fixed columns, readable by people (processed_order_<order num>.txt)
+ */
+class TextBillSink : public IBillSink
+{
+public:
+    /**
+     * @brief Construct a new TextBillSink object
+     */
+    explicit TextBillSink() = default;
+    /**
+     * @brief Destroy the TextBillSink object
+     */
+    ~TextBillSink() = default;
+
+    const char* getExtension() const override;
+    size_t getMaxLength(const BillSummary& summary) const override;
+    size_t getMaxLength(const BillLine& line) const override;
+    char* writeHeader(char* out, const BillSummary& summary) const override;
+    char* writeLine(char* out, const BillSummary& summary, const BillLine& line) const override;
+    char* writeFooter(char* out, const BillSummary& summary) const override;
+};
@@ -0,0 +1,214 @@
+/**
+ * @file BoundedQueue.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief BoundedQueue class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <semaphore>
+#include <thread>
+
+/**
+ * @brief cache line size, keeps positions of producers & consumers apart
+ */
+#define BOUNDED_QUEUE_LINE_LEN 64
+
+/**
+ * @brief Bounded multi producer multi consumer FIFO queue (single producer & consumer is special case of it).
+ *        Values live within ring of cells, every cell carries sequence number which tells whether it is free
+ *        or filled within current lap, so producers & consumers claim cells with atomic positions, without mutex.
+ *        Blocking (backpressure of full queue & waiting on empty one) is done with semaphores of free slots & values.
+ *
+ * @tparam T - default constructible & movable value type
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    /**
+     * @brief Construct a new BoundedQueue object
+     *
+     * @param[in] capacity - maximal number of queued values (at least 1)
+     */
+    explicit BoundedQueue(size_t capacity);
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Method which appends value, blocks while queue is full
+     *
+     * @param[in] value - value to append
+     */
+    void push(T value);
+    /**
+     * @brief Method which takes the oldest value, blocks while queue is empty & open
+     *
+     * @param[out] value - taken value
+     * @return true - value is taken
+     * @return false - queue is closed & empty
+     */
+    bool pop(T& value);
+    /**
+     * @brief Method which wakes every waiting consumer once queue is empty.
+     *        Shall be called once, after the last push of every producer has returned.
+     */
+    void close();
+
+    /**
+     * @brief Get the number of queued values (approximate while producers & consumers run)
+     */
+    size_t size() const;
+    /**
+     * @brief Get the maximal number of queued values
+     */
+    size_t capacity() const;
+private:
+    /**
+     * @brief Slot of ring
+     */
+    struct Cell
+    {
+        /**
+         * @brief position which may be filled (equal to position) or taken (position + 1) next
+         */
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    /**
+     * @brief ring of cells, length is power of 2
+     */
+    std::unique_ptr<Cell[]> mCells;
+    /**
+     * @brief length of ring - 1
+     */
+    size_t mMask;
+    /**
+     * @brief maximal number of queued values
+     */
+    size_t mCapacity;
+    /**
+     * @brief position of next pushed value
+     */
+    alignas(BOUNDED_QUEUE_LINE_LEN) std::atomic<size_t> mEnqueuePos{0};
+    /**
+     * @brief position of next popped value
+     */
+    alignas(BOUNDED_QUEUE_LINE_LEN) std::atomic<size_t> mDequeuePos{0};
+    /**
+     * @brief free slots (producer waits on it)
+     */
+    alignas(BOUNDED_QUEUE_LINE_LEN) std::counting_semaphore<> mSlots;
+    /**
+     * @brief queued values & one release of close (consumer waits on it)
+     */
+    std::counting_semaphore<> mValues{0};
+    /**
+     * @brief set by close
+     */
+    std::atomic<bool> mClosed{false};
+};
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(size_t capacity) :
+    mCapacity{std::max<size_t>(1, capacity)},
+    mSlots{static_cast<std::ptrdiff_t>(std::max<size_t>(1, capacity))}
+{
+    size_t length = 1;
+    while (length < mCapacity)
+    {
+        length *= 2;
+    }
+
+    mCells = std::make_unique<Cell[]>(length);
+    mMask = length - 1;
+    for (size_t i = 0; i < length; i++)
+    {
+        mCells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+void BoundedQueue<T>::push(T value)
+{
+    // free slot guarantees that position is freed eventually, consumer of previous lap may still be moving value out
+    mSlots.acquire();
+    const size_t pos = mEnqueuePos.fetch_add(1, std::memory_order_relaxed);
+    Cell& cell = mCells[pos & mMask];
+    while (cell.sequence.load(std::memory_order_acquire) != pos)
+    {
+        std::this_thread::yield();
+    }
+
+    cell.value = std::move(value);
+    cell.sequence.store(pos + 1, std::memory_order_release);
+    mValues.release();
+}
+
+template <typename T>
+bool BoundedQueue<T>::pop(T& value)
+{
+    mValues.acquire();
+
+    size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Cell& cell = mCells[pos & mMask];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence == pos + 1)
+        {
+            // value is filled, claim it
+            if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                value = std::move(cell.value);
+                cell.sequence.store(pos + mMask + 1, std::memory_order_release);
+                mSlots.release();
+                return true;
+            }
+        }
+        else if (sequence < pos + 1 && mClosed.load(std::memory_order_acquire))
+        {
+            // every push has finished, so queue is empty for good, pass release of close to next consumer
+            mValues.release();
+            return false;
+        }
+        else
+        {
+            // producer of position is still moving value in or other consumer has claimed it
+            std::this_thread::yield();
+            pos = mDequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+void BoundedQueue<T>::close()
+{
+    mClosed.store(true, std::memory_order_release);
+    mValues.release();
+}
+
+template <typename T>
+size_t BoundedQueue<T>::size() const
+{
+    const size_t dequeuePos = mDequeuePos.load(std::memory_order_relaxed);
+    const size_t enqueuePos = mEnqueuePos.load(std::memory_order_relaxed);
+    return (enqueuePos > dequeuePos) ? std::min(enqueuePos - dequeuePos, mCapacity) : 0;
+}
+
+template <typename T>
+size_t BoundedQueue<T>::capacity() const
+{
+    return mCapacity;
+}
@@ -0,0 +1,55 @@
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    mThreads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; i++)
+    {
+        mThreads.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    // wake every worker thread once more, empty queue stops it
+    mSignals.release(mThreads.size());
+
+    for (std::thread& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+size_t ThreadPool::getNumOfThreads() const
+{
+    return mThreads.size();
+}
+
+void ThreadPool::work()
+{
+    std::function<void()> task;
+
+    while (true)
+    {
+        mSignals.acquire();
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            // queued tasks are finished before stopping
+            if (mTasks.empty())
+            {
+                return;
+            }
+            task = std::move(mTasks.front());
+            mTasks.pop();
+        }
+        task();
+    }
+}
@@ -0,0 +1,94 @@
+/**
+ * @file ThreadPool.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief ThreadPool class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed size thread pool with single FIFO task queue
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Construct a new ThreadPool object & start worker threads
+     *
+     * @param[in] numThreads - number of worker threads (0 means hardware concurrency)
+     */
+    explicit ThreadPool(size_t numThreads = 0);
+    /**
+     * @brief Destroy the ThreadPool object. Finishes queued tasks & joins worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Method which queues task
+     *
+     * @param[in] function - task to execute
+     * @return std::future - result of task (exception thrown by task is rethrown on get)
+     */
+    template <typename Function>
+    auto submit(Function function) -> std::future<decltype(function())>;
+
+    /**
+     * @brief Get the number of worker threads
+     *
+     * @return size_t - number of worker threads
+     */
+    size_t getNumOfThreads() const;
+private:
+    /**
+     * @brief worker threads
+     */
+    std::vector<std::thread> mThreads;
+    /**
+     * @brief queued tasks
+     */
+    std::queue<std::function<void()>> mTasks;
+    /**
+     * @brief task queue synchronization
+     */
+    std::mutex mMutex;
+    /**
+     * @brief released once per queued task & once per worker thread on destruction
+     */
+    std::counting_semaphore<> mSignals{0};
+
+    /**
+     * @brief Worker thread loop
+     */
+    void work();
+};
+
+template <typename Function>
+auto ThreadPool::submit(Function function) -> std::future<decltype(function())>
+{
+    // packaged_task is move-only, std::function needs copyable callable
+    auto task = std::make_shared<std::packaged_task<decltype(function())()>>(std::move(function));
+    auto result = task->get_future();
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTasks.emplace([task]() { (*task)(); });
+    }
+    mSignals.release();
+    return result;
+}
@@ -0,0 +1,210 @@
+#include <algorithm>
+
+#include "WorkStealingScheduler.h"
+
+/**
+ * @brief number of yields of worker waiting for group before it sleeps
+ */
+#define WAIT_SPIN_LEN 64
+
+/**
+ * @brief scheduler of calling worker thread (NULL for thread which is not worker)
+ */
+static thread_local const WorkStealingScheduler* CurrentScheduler = nullptr;
+/**
+ * @brief index of calling worker thread within its scheduler
+ */
+static thread_local size_t CurrentWorker = 0;
+
+TaskGroup::TaskGroup() :
+    mState{std::make_shared<State>()}
+{
+
+}
+
+WorkStealingScheduler::WorkStealingScheduler(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (size_t i = 0; i < numThreads; i++)
+    {
+        mQueues.push_back(std::make_unique<Queue>());
+    }
+    mThreads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; i++)
+    {
+        mThreads.emplace_back(&WorkStealingScheduler::work, this, i);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    // wake every worker thread once more, it stops when every queue is empty
+    mStop = true;
+    mSignals.release(mThreads.size());
+
+    for (std::thread& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+void WorkStealingScheduler::submit(TaskGroup& group, std::function<void()> task)
+{
+    const size_t worker = this->getWorkerIndex();
+    const size_t index = (worker < mQueues.size()) ? worker : mNextQueue++ % mQueues.size();
+
+    // task is pending from now on, so group can't finish before subtasks of its running task
+    group.mState->pending++;
+    {
+        std::lock_guard<std::mutex> lock(mQueues[index]->mutex);
+        mQueues[index]->tasks.push_back(Task{std::move(task), group.mState});
+    }
+    mSignals.release();
+}
+
+void WorkStealingScheduler::wait(TaskGroup& group) noexcept(false)
+{
+    const size_t worker = this->getWorkerIndex();
+    const std::shared_ptr<TaskGroup::State> state = group.mState;
+    size_t spins = 0;
+    Task task;
+
+    while (state->pending != 0)
+    {
+        // only tasks of group, unrelated (maybe long) tasks would delay the waiter & nest its frames
+        if (this->takeTask(worker, task, state.get()))
+        {
+            this->run(task);
+            spins = 0;
+        }
+        else if (spins < WAIT_SPIN_LEN)
+        {
+            // the rest of group is running on other threads, which may still spawn subtasks soon
+            spins++;
+            std::this_thread::yield();
+        }
+        else if (state->pending != 0)
+        {
+            // sleep until the last running task of group finishes (or spawns subtask & finishes)
+            state->done.acquire();
+            spins = 0;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->error)
+    {
+        std::exception_ptr error = state->error;
+        state->error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+size_t WorkStealingScheduler::getNumOfThreads() const
+{
+    return mThreads.size();
+}
+
+size_t WorkStealingScheduler::getNumOfSteals() const
+{
+    return mNumOfSteals;
+}
+
+void WorkStealingScheduler::work(size_t index)
+{
+    Task task;
+
+    CurrentScheduler = this;
+    CurrentWorker = index;
+    while (true)
+    {
+        if (this->takeTask(index, task))
+        {
+            this->run(task);
+            continue;
+        }
+
+        // queued tasks are finished before stopping
+        if (mStop)
+        {
+            return;
+        }
+        mSignals.acquire();
+    }
+}
+
+bool WorkStealingScheduler::takeTask(size_t index, Task& task, const TaskGroup::State* group)
+{
+    // the newest task of own queue
+    if (index < mQueues.size())
+    {
+        Queue& queue = *mQueues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (auto it = queue.tasks.rbegin(); it != queue.tasks.rend(); it++)
+        {
+            if (!group || it->group.get() == group)
+            {
+                task = std::move(*it);
+                queue.tasks.erase(std::next(it).base());
+                return true;
+            }
+        }
+    }
+
+    // the oldest task of another queue, starting behind own one so thieves spread over victims
+    for (size_t i = 1; i <= mQueues.size(); i++)
+    {
+        const size_t victim = (index + i) % mQueues.size();
+        if (victim == index)
+        {
+            continue;
+        }
+
+        Queue& queue = *mQueues[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (auto it = queue.tasks.begin(); it != queue.tasks.end(); it++)
+        {
+            if (!group || it->group.get() == group)
+            {
+                task = std::move(*it);
+                queue.tasks.erase(it);
+                mNumOfSteals++;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void WorkStealingScheduler::run(Task& task)
+{
+    const std::shared_ptr<TaskGroup::State> group = std::move(task.group);
+
+    try
+    {
+        task.function();
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(group->mutex);
+        if (!group->error)
+        {
+            group->error = std::current_exception();
+        }
+    }
+    task.function = nullptr;
+
+    if (--group->pending == 0)
+    {
+        group->done.release();
+    }
+}
+
+size_t WorkStealingScheduler::getWorkerIndex() const
+{
+    return (CurrentScheduler == this) ? CurrentWorker : mQueues.size();
+}
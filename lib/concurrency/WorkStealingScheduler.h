@@ -0,0 +1,178 @@
+/**
+ * @file WorkStealingScheduler.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief TaskGroup & WorkStealingScheduler class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Set of tasks which are waited together (i.e. every chunk of single file)
+ */
+class TaskGroup
+{
+    friend class WorkStealingScheduler;
+public:
+    TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+private:
+    /**
+     * @brief State shared with tasks, so the last task may signal group which is already destroyed by its waiter
+     */
+    struct State
+    {
+        /**
+         * @brief number of submitted & unfinished tasks
+         */
+        std::atomic<size_t> pending = 0;
+        /**
+         * @brief released every time the last pending task finishes
+         */
+        std::counting_semaphore<> done{0};
+        /**
+         * @brief the first exception thrown by task
+         */
+        std::exception_ptr error;
+        /**
+         * @brief error synchronization
+         */
+        std::mutex mutex;
+    };
+
+    std::shared_ptr<State> mState;
+};
+
+/**
+ * @brief Fixed size thread pool where every worker thread owns double ended task queue.
+ *        Worker takes the newest task of its own queue (subtasks it has just spawned are still in cache),
+ *        idle worker steals the oldest task of another queue (usually the biggest piece of work left).
+ *        Task may submit subtasks & wait for them, waiting thread executes tasks meanwhile instead of blocking,
+ *        so nested waits never run out of threads.
+ */
+class WorkStealingScheduler
+{
+public:
+    /**
+     * @brief Construct a new WorkStealingScheduler object & start worker threads
+     *
+     * @param[in] numThreads - number of worker threads (0 means hardware concurrency)
+     */
+    explicit WorkStealingScheduler(size_t numThreads = 0);
+    /**
+     * @brief Destroy the WorkStealingScheduler object. Finishes queued tasks & joins worker threads.
+     */
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+    /**
+     * @brief Method which queues task of group.
+     *        Task submitted by worker thread goes into its own queue, other threads spread tasks over every queue.
+     *
+     * @param[in, out] group - group of task
+     * @param[in] task - task to execute, thrown exception is rethrown by wait
+     */
+    void submit(TaskGroup& group, std::function<void()> task);
+    /**
+     * @brief Method which waits for every task of group & executes its queued tasks meanwhile.
+     *        Once no task of group is queued, waiter spins shortly & then sleeps until group finishes.
+     *
+     * @exception the first exception thrown by task of group
+     *
+     * @param[in, out] group - group to wait for
+     */
+    void wait(TaskGroup& group) noexcept(false);
+
+    /**
+     * @brief Get the number of worker threads
+     *
+     * @return size_t - number of worker threads
+     */
+    size_t getNumOfThreads() const;
+    /**
+     * @brief Get the number of tasks taken from queue of another worker
+     *
+     * @return size_t - number of stolen tasks
+     */
+    size_t getNumOfSteals() const;
+private:
+    /**
+     * @brief Queued task with its group
+     */
+    struct Task
+    {
+        std::function<void()> function;
+        std::shared_ptr<TaskGroup::State> group;
+    };
+
+    /**
+     * @brief Task queue of single worker, owner uses its back, thieves use its front
+     */
+    struct Queue
+    {
+        std::deque<Task> tasks;
+        std::mutex mutex;
+    };
+
+    /**
+     * @brief worker threads
+     */
+    std::vector<std::thread> mThreads;
+    /**
+     * @brief queue of every worker thread
+     */
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    /**
+     * @brief released once per queued task & once per worker thread on destruction
+     */
+    std::counting_semaphore<> mSignals{0};
+    /**
+     * @brief next queue of task submitted by thread which is not worker
+     */
+    std::atomic<size_t> mNextQueue = 0;
+    std::atomic<size_t> mNumOfSteals = 0;
+    std::atomic<bool> mStop = false;
+
+    /**
+     * @brief Worker thread loop
+     *
+     * @param[in] index - index of worker (& its queue)
+     */
+    void work(size_t index);
+    /**
+     * @brief Method which takes task from own queue or steals it from another one
+     *
+     * @param[in] index - index of worker or number of workers for thread which is not worker
+     * @param[out] task - taken task
+     * @param[in] group - take only task of this group (NULL means any task)
+     * @return true - task is taken
+     * @return false - there is no (matching) queued task
+     */
+    bool takeTask(size_t index, Task& task, const TaskGroup::State* group = nullptr);
+    /**
+     * @brief Method which executes task & finishes it within its group
+     */
+    void run(Task& task);
+    /**
+     * @brief Get the index of worker of calling thread (number of workers for thread which is not worker)
+     */
+    size_t getWorkerIndex() const;
+};
@@ -0,0 +1,86 @@
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "BufferCsvReader.h"
+#include "CsvTokenizer.h"
+
+#define CSV_EXTENSION ".csv"
+#define CSV_EXTENSION_LEN 4
+
+void BufferCsvReader::open(std::string filename) noexcept(false)
+{
+    // validate format (extension) of file before reading it
+    this->open(filename, std::string());
+    mOpened = false;
+
+    std::ifstream reader(filename, std::ios::binary);
+    if (!reader.is_open())
+    {
+        throw std::runtime_error("Failed to open file " + filename);
+    }
+    mBuffer.assign(std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>());
+    mOpened = true;
+}
+
+void BufferCsvReader::open(const std::string& filename, std::string content) noexcept(false)
+{
+    // validate format (extension) of file
+    if (filename.find(CSV_EXTENSION) != filename.length() - CSV_EXTENSION_LEN)
+    {
+        throw std::runtime_error("Bad format (extension) for file " + filename);
+    }
+
+    // reset row cursor
+    mBufferOffset = mRowNum = 0;
+    mRow = std::string_view();
+
+    mBuffer = std::move(content);
+    mOpened = true;
+}
+
+bool BufferCsvReader::keepsRows() const
+{
+    return true;
+}
+
+bool BufferCsvReader::read(std::string* line) noexcept(false)
+{
+    if (!mOpened)
+    {
+        throw std::runtime_error("Can't read row because file is not opened.");
+    }
+
+    // check EOF
+    if (mBufferOffset >= mBuffer.length())
+    {
+        this->setRow(std::string_view());
+        return false;
+    }
+
+    // search for the end of row & its semicolons in place (in single pass)
+    const char* rowBegin = mBuffer.data() + mBufferOffset;
+    const size_t remaining = mBuffer.length() - mBufferOffset;
+    const size_t rowLength = CsvTokenizer::scanRow(rowBegin, remaining, mSemicolons);
+
+    // newline is not part of row (same as std::getline)
+    mRow = std::string_view(rowBegin, rowLength);
+    mColsCounter = 0;
+    mRowNum++;
+    mBufferOffset += (rowLength < remaining) ? rowLength + 1 : rowLength;
+
+    // assign to output if it's possible
+    if (line)
+    {
+        line->assign(mRow);
+    }
+    return true;
+}
+
+std::string BufferCsvReader::release()
+{
+    mOpened = false;
+    mBufferOffset = mRowNum = 0;
+    mRow = std::string_view();
+    return std::move(mBuffer);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file BufferCsvReader.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief BufferCsvReader class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+#include "IFileReader.h"
+
+/**
+ * @brief In-memory CSV File Reader class
+ *        owns content of file which was read by someone else (i.e. asynchronous I/O) & walks its rows in place
+ */
+class BufferCsvReader : public IFileReader
+{
+public:
+    /**
+     * @brief Construct a new BufferCsvReader object
+     */
+    explicit BufferCsvReader() = default;
+    /**
+     * @brief Destroy the BufferCsvReader object
+     */
+    ~BufferCsvReader() = default;
+
+    /**
+     * @brief Method which tries to open file & reads it whole into buffer
+     *
+     * @exception std::runtime_error - if open file has failed
+     *
+     * @param[in] filename - file to read
+     */
+    void open(std::string filename) noexcept(false) override;
+    /**
+     * @brief Method which opens content of already read file
+     *
+     * @exception std::runtime_error - if file isn't CSV file
+     *
+     * @param[in] filename - file of content
+     * @param[in] content - whole content of file
+     */
+    void open(const std::string& filename, std::string content) noexcept(false);
+    /**
+     * @brief Method which reads line within buffer.
+     *        It shall read next line every time until EOF.
+     *
+     * @exception std::runtime_error if file is not opened
+     *
+     * @param[out] line - external storage for readen line (optional/nullable)
+     * @return true - line succesfully read
+     * @return false - EOF
+     */
+    bool read(std::string* line = nullptr) noexcept(false) override;
+    /**
+     * @brief Method which tells that rows outlive next read (they point into buffer)
+     *
+     * @return true - always
+     */
+    bool keepsRows() const override;
+    /**
+     * @brief Method which releases buffer, so it can be reused (i.e. for next file)
+     *
+     * @return std::string - content of file
+     */
+    std::string release();
+private:
+    /**
+     * @brief content of file
+     */
+    std::string mBuffer;
+    /**
+     * @brief offset of the next row within buffer
+     */
+    size_t mBufferOffset = 0;
+    bool mOpened = false;
+};
@@ -21,6 +21,7 @@ void CsvReader::open(std::string filename) noexcept(false)
 
     // open file
     mReader.open(filename);
+    mRowNum = 0;
 
     // check is file opened
     if (!mReader.is_open())
@@ -36,62 +37,20 @@ bool CsvReader::read(std::string* line) noexcept(false)
         throw std::runtime_error("Can't read row because file is not opened.");
     }
 
-    // reset offsets & counters
-    mRowStartOffset = mColsCounter = 0;
-    mRowEndOffset = -1;
-
     // try to read line
-    if (std::getline(mReader, mRow))
+    if (std::getline(mReader, mLine))
     {
+        // cells are extracted from view of row storage
+        this->setRow(mLine);
+        mRowNum++;
+
         // assign to output if it's possible
         if (line)
         {
-            line->assign(mRow);
+            line->assign(mLine);
         }
         return true;
     }
+    this->setRow(std::string_view());
     return false;
 }
-
-std::string CsvReader::extract() noexcept(false)
-{
-    // check there are more cells within row
-    if (mColsCounter >= mNumOfCols)
-    {
-        throw std::runtime_error("There are no more cells within a row");
-    }
-
-    // set starting offset
-    mRowStartOffset = mRowEndOffset + 1;
-
-    // check the range of the cell
-    if (mColsCounter == mNumOfCols - 1)
-    {
-        // set end offset to end of row
-        mRowEndOffset = mRow.length();
-    }
-    else
-    {
-        // search for semicolon
-        const size_t semicolonPos = mRow.find(';', mRowStartOffset);
-        if (semicolonPos == std::string::npos)
-        {
-            mRowEndOffset = -1;
-        }
-        else
-        {
-            mRowEndOffset = static_cast<int>(semicolonPos);
-        }
-    }
-
-    if (mRowStartOffset == mRowEndOffset || mRowEndOffset == -1)
-    {
-        throw std::runtime_error("Can't find cell");
-    }
-
-    // increment columns counter
-    mColsCounter++;
-
-    // substring cell
-    return mRow.substr(mRowStartOffset, mRowEndOffset - mRowStartOffset);
-}
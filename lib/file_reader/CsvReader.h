@@ -11,7 +11,7 @@
 
 #pragma once
 
-#include <regex>
+#include <fstream>
 
 #include "IFileReader.h"
 
@@ -52,20 +52,11 @@ public:
     bool read(std::string* line = nullptr) noexcept(false) override;
 private:
     /**
-     * @brief row storage 
+     * @brief file reader
      */
-    std::string mRow;
+    std::ifstream mReader;
     /**
-     * @brief row / colums offsets
+     * @brief row storage (viewed by mRow)
      */
-    int mRowStartOffset = 0;
-    int mRowEndOffset = 0;
-    int mColsCounter = 0;
-
-    /**
-     * @brief Method which extracts cell from line and leaves it in raw (including whitespaces, etc.)
-     *
-     * @return std::string extracted cell
-     */
-    std::string extract() noexcept(false) override;
+    std::string mLine;
 };
@@ -0,0 +1,343 @@
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CSV_TOKENIZER_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__)
+#define CSV_TOKENIZER_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+#include "CsvTokenizer.h"
+
+#define BLOCK_LEN 64
+#define CLASS_BLANK 0x1
+#define CLASS_NEWLINE 0x2
+
+/**
+ * @brief Classification of 64 characters, one bit per character
+ */
+struct BlockMasks
+{
+    uint64_t semicolon;
+    uint64_t newline;
+    uint64_t blank;
+    uint64_t carriage;
+};
+
+/**
+ * @brief Block classification function (reads exactly BLOCK_LEN characters)
+ */
+using ClassifyFunction = BlockMasks (*)(const char* block);
+
+/**
+ * @brief Character class table used for trimming
+ */
+static constexpr std::array<uint8_t, 256> cCharClass = []()
+{
+    std::array<uint8_t, 256> table{};
+    table[static_cast<uint8_t>('\t')] = CLASS_BLANK;
+    table[static_cast<uint8_t>(' ')] = CLASS_BLANK;
+    table[static_cast<uint8_t>('\r')] = CLASS_NEWLINE;
+    table[static_cast<uint8_t>('\n')] = CLASS_NEWLINE;
+    return table;
+}();
+
+/**
+ * @brief Classifies block character by character
+ *
+ * @param[in] block - BLOCK_LEN characters
+ * @return BlockMasks - classification bitmasks
+ */
+static BlockMasks classifyScalar(const char* block);
+#ifdef CSV_TOKENIZER_SSE2
+/**
+ * @brief Classifies block with SSE2 (4 x 16 characters)
+ */
+static BlockMasks classifySse2(const char* block);
+#endif
+#ifdef CSV_TOKENIZER_AVX2
+/**
+ * @brief Classifies block with AVX2 (2 x 32 characters)
+ */
+static BlockMasks classifyAvx2(const char* block);
+#endif
+/**
+ * @brief Detects best instruction set supported by CPU
+ *
+ * @return CsvTokenizer::Isa - best instruction set
+ */
+static CsvTokenizer::Isa detectIsa();
+/**
+ * @brief Get the classification function of instruction set
+ *
+ * @param[in] isa - instruction set
+ * @return ClassifyFunction - classification function
+ */
+static ClassifyFunction selectClassify(CsvTokenizer::Isa isa);
+/**
+ * @brief Get the block starting at offset, tail block is copied into zero padded buffer
+ *
+ * @param[in] data - buffer
+ * @param[in] offset - offset of block
+ * @param[in] length - buffer length
+ * @param[out] padded - storage for tail block
+ * @return const char* - BLOCK_LEN readable characters
+ */
+static const char* loadBlock(const char* data, size_t offset, size_t length, char* padded);
+/**
+ * @brief Appends offsets of set bits
+ *
+ * @param[in] bits - bitmask of block
+ * @param[in] offset - offset of block
+ * @param[out] positions - storage for offsets
+ */
+static void appendPositions(uint64_t bits, size_t offset, std::vector<uint32_t>& positions);
+
+/**
+ * @brief instruction set in use & its classification function
+ */
+static CsvTokenizer::Isa sIsa = detectIsa();
+static ClassifyFunction sClassify = selectClassify(sIsa);
+
+size_t CsvTokenizer::scanRow(const char* data, size_t length, std::vector<uint32_t>& semicolons)
+{
+    char padded[BLOCK_LEN];
+
+    semicolons.clear();
+
+    for (size_t offset = 0; offset < length; offset += BLOCK_LEN)
+    {
+        const BlockMasks masks = sClassify(loadBlock(data, offset, length, padded));
+        if (masks.newline)
+        {
+            // keep only semicolons in front of newline
+            const int newline = std::countr_zero(masks.newline);
+            appendPositions(masks.semicolon & ((1ULL << newline) - 1), offset, semicolons);
+            return offset + newline;
+        }
+        appendPositions(masks.semicolon, offset, semicolons);
+    }
+    return length;
+}
+
+void CsvTokenizer::tokenize(const char* data, size_t length, std::vector<CsvCell>& cells, std::vector<size_t>& rowEnds)
+{
+    char padded[BLOCK_LEN];
+    size_t cellStart = 0;
+
+    for (size_t offset = 0; offset < length; offset += BLOCK_LEN)
+    {
+        const BlockMasks masks = sClassify(loadBlock(data, offset, length, padded));
+        uint64_t delimiters = masks.semicolon | masks.newline;
+
+        while (delimiters)
+        {
+            const int bit = std::countr_zero(delimiters);
+            const size_t delimiter = offset + bit;
+            CsvCell cell = {cellStart, delimiter};
+
+            if (cellStart >= offset)
+            {
+                // skip blanks with mask, delimiter itself isn't blank so search ends at it
+                cell.begin += std::countr_zero(~masks.blank >> (cellStart - offset));
+            }
+            else
+            {
+                // cell started within one of previous blocks
+                while (cell.begin < cell.end && (cCharClass[static_cast<uint8_t>(data[cell.begin])] & CLASS_BLANK))
+                {
+                    cell.begin++;
+                }
+            }
+            if (bit > 0)
+            {
+                // drop carriage returns in front of delimiter with mask
+                cell.end -= std::countl_one(masks.carriage << (BLOCK_LEN - bit));
+            }
+            // carriage returns which reach into previous block
+            while (cell.end > cell.begin && (cCharClass[static_cast<uint8_t>(data[cell.end - 1])] & CLASS_NEWLINE))
+            {
+                cell.end--;
+            }
+            cells.push_back(cell);
+
+            if ((masks.newline >> bit) & 1)
+            {
+                rowEnds.push_back(cells.size());
+            }
+
+            cellStart = delimiter + 1;
+            delimiters &= delimiters - 1;
+        }
+    }
+
+    // last row without newline
+    if (cellStart < length)
+    {
+        const std::string_view cell = CsvTokenizer::trim(std::string_view(data + cellStart, length - cellStart));
+        cells.push_back({static_cast<size_t>(cell.data() - data), static_cast<size_t>(cell.data() - data) + cell.length()});
+        rowEnds.push_back(cells.size());
+    }
+}
+
+std::string_view CsvTokenizer::trim(std::string_view cell)
+{
+    size_t begin = 0;
+    size_t end = cell.length();
+
+    while (begin < end && (cCharClass[static_cast<uint8_t>(cell[begin])] & CLASS_BLANK))
+    {
+        begin++;
+    }
+    while (end > begin && (cCharClass[static_cast<uint8_t>(cell[end - 1])] & CLASS_NEWLINE))
+    {
+        end--;
+    }
+    return cell.substr(begin, end - begin);
+}
+
+CsvTokenizer::Isa CsvTokenizer::getIsa()
+{
+    return sIsa;
+}
+
+void CsvTokenizer::setIsa(Isa isa)
+{
+    const Isa best = detectIsa();
+    sIsa = (static_cast<int>(isa) > static_cast<int>(best)) ? best : isa;
+    sClassify = selectClassify(sIsa);
+}
+
+static BlockMasks classifyScalar(const char* block)
+{
+    BlockMasks masks = {0, 0, 0, 0};
+    for (int i = 0; i < BLOCK_LEN; i++)
+    {
+        const uint64_t bit = 1ULL << i;
+        switch (block[i])
+        {
+        case ';':
+            masks.semicolon |= bit;
+            break;
+        case '\n':
+            masks.newline |= bit;
+            break;
+        case '\t':
+        case ' ':
+            masks.blank |= bit;
+            break;
+        case '\r':
+            masks.carriage |= bit;
+            break;
+        default:
+            break;
+        }
+    }
+    return masks;
+}
+
+#ifdef CSV_TOKENIZER_SSE2
+static BlockMasks classifySse2(const char* block)
+{
+    const __m128i semicolon = _mm_set1_epi8(';');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i carriage = _mm_set1_epi8('\r');
+    BlockMasks masks = {0, 0, 0, 0};
+
+    for (int i = 0; i < BLOCK_LEN / 16; i++)
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i * 16));
+        const int shift = i * 16;
+        masks.semicolon |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, semicolon)))) << shift;
+        masks.newline |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, newline)))) << shift;
+        masks.blank |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(chars, tab), _mm_cmpeq_epi8(chars, space))))) << shift;
+        masks.carriage |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, carriage)))) << shift;
+    }
+    return masks;
+}
+#endif
+
+#ifdef CSV_TOKENIZER_AVX2
+__attribute__((target("avx2")))
+static BlockMasks classifyAvx2(const char* block)
+{
+    const __m256i semicolon = _mm256_set1_epi8(';');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i carriage = _mm256_set1_epi8('\r');
+    BlockMasks masks = {0, 0, 0, 0};
+
+    for (int i = 0; i < BLOCK_LEN / 32; i++)
+    {
+        const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i * 32));
+        const int shift = i * 32;
+        masks.semicolon |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, semicolon)))) << shift;
+        masks.newline |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, newline)))) << shift;
+        masks.blank |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chars, tab), _mm256_cmpeq_epi8(chars, space))))) << shift;
+        masks.carriage |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chars, carriage)))) << shift;
+    }
+    return masks;
+}
+#endif
+
+static CsvTokenizer::Isa detectIsa()
+{
+#if defined(CSV_TOKENIZER_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return CsvTokenizer::Isa::Avx2;
+    }
+#endif
+#if defined(CSV_TOKENIZER_SSE2)
+    return CsvTokenizer::Isa::Sse2;
+#else
+    return CsvTokenizer::Isa::Scalar;
+#endif
+}
+
+static ClassifyFunction selectClassify(CsvTokenizer::Isa isa)
+{
+    switch (isa)
+    {
+#ifdef CSV_TOKENIZER_AVX2
+    case CsvTokenizer::Isa::Avx2:
+        return classifyAvx2;
+#endif
+#ifdef CSV_TOKENIZER_SSE2
+    case CsvTokenizer::Isa::Sse2:
+        return classifySse2;
+#endif
+    default:
+        return classifyScalar;
+    }
+}
+
+static const char* loadBlock(const char* data, size_t offset, size_t length, char* padded)
+{
+    if (length - offset >= BLOCK_LEN)
+    {
+        return data + offset;
+    }
+    // zero padding doesn't match any class
+    std::memset(padded, 0, BLOCK_LEN);
+    std::memcpy(padded, data + offset, length - offset);
+    return padded;
+}
+
+static void appendPositions(uint64_t bits, size_t offset, std::vector<uint32_t>& positions)
+{
+    while (bits)
+    {
+        positions.push_back(static_cast<uint32_t>(offset + std::countr_zero(bits)));
+        bits &= bits - 1;
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * @file CsvTokenizer.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief CsvTokenizer class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Cell boundaries within tokenized buffer (trimmed like IFileReader cells)
+ */
+struct CsvCell
+{
+    /**
+     * @brief offset of first character of cell
+     */
+    size_t begin;
+    /**
+     * @brief offset behind last character of cell
+     */
+    size_t end;
+};
+
+/**
+ * @brief Vectorized CSV tokenizer.
+ *        Classifies blocks of 64 characters at once (';', '\t', ' ', '\r' & '\n' bitmasks)
+ *        with SSE2/AVX2 implementation chosen at runtime, or with scalar fallback.
+ */
+class CsvTokenizer
+{
+public:
+    /**
+     * @brief Instruction set used for classification
+     */
+    enum class Isa
+    {
+        Scalar,
+        Sse2,
+        Avx2
+    };
+
+    /**
+     * @brief Scans row which starts at data: finds its end ('\n') and semicolons within it
+     *
+     * @param[in] data - beginning of row
+     * @param[in] length - number of characters available from data
+     * @param[out] semicolons - offsets of semicolons within row (cleared first)
+     * @return size_t - row length (offset of '\n' or length if there is no newline)
+     */
+    static size_t scanRow(const char* data, size_t length, std::vector<uint32_t>& semicolons);
+    /**
+     * @brief Tokenizes whole buffer into rows & cells.
+     *        Rows are split on '\n' (trailing newline doesn't make an empty row, same as std::getline),
+     *        cells are split on every ';', trimmed from '\t' & ' ' in front and '\r' at back.
+     *
+     * @param[in] data - buffer to tokenize
+     * @param[in] length - buffer length
+     * @param[out] cells - boundaries of all cells (appended)
+     * @param[out] rowEnds - index behind last cell of every row within cells (appended)
+     */
+    static void tokenize(const char* data, size_t length, std::vector<CsvCell>& cells, std::vector<size_t>& rowEnds);
+
+    /**
+     * @brief Trims cell the same way as tokenize does (without any allocation)
+     *
+     * @param[in] cell - raw cell
+     * @return std::string_view - cell without '\t' & ' ' in front and '\r' & '\n' at back
+     */
+    static std::string_view trim(std::string_view cell);
+
+    /**
+     * @brief Get the instruction set chosen for this CPU
+     *
+     * @return Isa - used instruction set
+     */
+    static Isa getIsa();
+    /**
+     * @brief Force instruction set (falls back to best supported one if CPU lacks it)
+     *
+     * @param[in] isa - instruction set to use
+     */
+    static void setIsa(Isa isa);
+};
@@ -1,20 +1,21 @@
+#include <stdexcept>
+
 #include "IFileReader.h"
+#include "NumberParser.h"
+#include "CsvTokenizer.h"
 
-double IFileReader::extractDouble(std::function<bool(const std::string&, std::string&)> validate) noexcept(false)
+double IFileReader::extractDouble(std::function<bool(std::string_view, std::string&)> validate) noexcept(false)
 {
-    // read cell
-    std::string cell = this->extract();
-
-    // remove whitespaces & tabs
-    this->eraseCharactersFromString(cell, "\t ", true);
+    double value = 0;
 
-    // remove newline
-    this->eraseCharactersFromString(cell, "\r\n", false);
+    // read trimmed cell
+    const std::string_view cell = this->extractTrimmed();
 
-    // validate cell
-    if (!std::regex_match(cell, cPositiveDecReg))
+    // validate & convert cell in single pass
+    const ParseStatus status = parseDecimal(cell, value);
+    if (status == ParseStatus::NotNumber)
     {
-        throw std::runtime_error('"' + cell + '"' + " is not a decimal number.");
+        throwOnParseFailure(status, cell, "decimal number", nullptr);
     }
 
     // additional validation
@@ -23,29 +24,27 @@ double IFileReader::extractDouble(std::function<bool(const std::string&, std::st
         std::string error;
         if (!validate(cell, error))
         {
-            throw std::runtime_error('"' + cell + '"' + " is not valid. " + error);
+            throw std::runtime_error('"' + std::string(cell) + '"' + " is not valid. " + error);
         }
     }
 
-    // convert to double
-    return std::stod(cell);
+    // report conversion failure after external validation
+    throwOnParseFailure(status, cell, "decimal number", "stod");
+    return value;
 }
 
-float IFileReader::extractFloat(std::function<bool(const std::string&, std::string&)> validate) noexcept(false)
+float IFileReader::extractFloat(std::function<bool(std::string_view, std::string&)> validate) noexcept(false)
 {
-    // read cell
-    std::string cell = this->extract();
-
-    // remove whitespaces & tabs
-    this->eraseCharactersFromString(cell, "\t ", true);
+    float value = 0;
 
-    // remove newline
-    this->eraseCharactersFromString(cell, "\r\n", false);
+    // read trimmed cell
+    const std::string_view cell = this->extractTrimmed();
 
-    // validate third cell
-    if (!std::regex_match(cell, cPositiveDecReg))
+    // validate & convert cell in single pass
+    const ParseStatus status = parseDecimal(cell, value);
+    if (status == ParseStatus::NotNumber)
     {
-        throw std::runtime_error('"' + cell + '"' + " is not a decimal number.");
+        throwOnParseFailure(status, cell, "decimal number", nullptr);
     }
 
     // additional validation
@@ -54,29 +53,27 @@ float IFileReader::extractFloat(std::function<bool(const std::string&, std::stri
         std::string error;
         if (!validate(cell, error))
         {
-            throw std::runtime_error('"' + cell + '"' + " is not valid. " + error);
+            throw std::runtime_error('"' + std::string(cell) + '"' + " is not valid. " + error);
         }
     }
 
-    // convert to float
-    return std::stof(cell);
+    // report conversion failure after external validation
+    throwOnParseFailure(status, cell, "decimal number", "stof");
+    return value;
 }
 
-uint64_t IFileReader::extractULongLong(std::function<bool(const std::string&, std::string&)> validate) noexcept(false)
+uint64_t IFileReader::extractULongLong(std::function<bool(std::string_view, std::string&)> validate) noexcept(false)
 {
-    // read cell
-    std::string cell = this->extract();
+    uint64_t value = 0;
 
-    // remove whitespaces & tabs
-    this->eraseCharactersFromString(cell, "\t ", true);
+    // read trimmed cell
+    const std::string_view cell = this->extractTrimmed();
 
-    // remove newline
-    this->eraseCharactersFromString(cell, "\r\n", false);
-
-    // validate cell
-    if (!std::regex_match(cell, cPositiveNumReg))
+    // validate & convert cell in single pass
+    const ParseStatus status = parseNatural(cell, value);
+    if (status == ParseStatus::NotNumber)
     {
-        throw std::runtime_error('"' + cell + '"' + " is not a natural number.");
+        throwOnParseFailure(status, cell, "natural number", nullptr);
     }
 
     // additional validation
@@ -85,24 +82,25 @@ uint64_t IFileReader::extractULongLong(std::function<bool(const std::string&, st
         std::string error;
         if (!validate(cell, error))
         {
-            throw std::runtime_error('"' + cell + '"' + " is not valid. " + error);
+            throw std::runtime_error('"' + std::string(cell) + '"' + " is not valid. " + error);
         }
     }
 
-    // convert string to int
-    return std::stoull(cell);
+    // report conversion failure after external validation
+    throwOnParseFailure(status, cell, "natural number", "stoull");
+    return value;
 }
 
-std::string IFileReader::extractString(std::function<bool(const std::string&, std::string&)> validate) noexcept(false)
+std::string IFileReader::extractString(std::function<bool(std::string_view, std::string&)> validate) noexcept(false)
 {
-    // read cell
-    std::string cell = this->extract();
-
-    // remove whitespaces & tabs
-    this->eraseCharactersFromString(cell, "\t ", true);
+    // the only extraction which copies cell
+    return std::string(this->extractStringView(validate));
+}
 
-    // remove newline
-    this->eraseCharactersFromString(cell, "\r\n", false);
+std::string_view IFileReader::extractStringView(std::function<bool(std::string_view, std::string&)> validate) noexcept(false)
+{
+    // read trimmed cell
+    const std::string_view cell = this->extractTrimmed();
 
     // additional validation
     if (validate)
@@ -110,13 +108,33 @@ std::string IFileReader::extractString(std::function<bool(const std::string&, st
         std::string error;
         if (!validate(cell, error))
         {
-            throw std::runtime_error('"' + cell + '"' + " is not valid. " + error);
+            throw std::runtime_error('"' + std::string(cell) + '"' + " is not valid. " + error);
         }
     }
 
     return cell;
 }
 
+bool IFileReader::keepsRows() const
+{
+    return false;
+}
+
+std::string_view IFileReader::getRow() const
+{
+    return mRow;
+}
+
+const std::vector<uint32_t>& IFileReader::getSemicolons() const
+{
+    return mSemicolons;
+}
+
+size_t IFileReader::getRowNum() const
+{
+    return mRowNum;
+}
+
 int IFileReader::getNumOfCols() const
 {
     return mNumOfCols;
@@ -127,72 +145,59 @@ void IFileReader::setNumOfCols(int num)
     mNumOfCols = num;
 }
 
-void IFileReader::eraseCharactersFromString(std::string& str, const char* charGroup, bool front)
+void IFileReader::setRow(std::string_view row)
 {
-    // erase indexes
-    int eraseStart = -1;
-    int eraseEnd = -1;
+    mRow = row;
+    mColsCounter = 0;
 
-    // front/back utils
-    int step;
-    int beginIdx;
-    std::function<bool(int)> check;
+    // find all semicolons at once
+    CsvTokenizer::scanRow(row.data(), row.length(), mSemicolons);
+}
 
-    // assign utils values
-    if (front)
+std::string_view IFileReader::extract() noexcept(false)
+{
+    size_t startOffset;
+    size_t endOffset;
+
+    // check there are more cells within row
+    if (mColsCounter >= mNumOfCols)
     {
-        step = 1;
-        beginIdx = 0;
-        check = [&](int i)
-        {
-            return i < (int)str.length();
-        };
+        throw std::runtime_error("There are no more cells within a row");
     }
-    else
+
+    // cell starts behind previous semicolon
+    startOffset = (mColsCounter == 0) ? 0 : mSemicolons[mColsCounter - 1] + 1;
+
+    // check the range of the cell
+    if (mColsCounter == mNumOfCols - 1)
     {
-        step = -1;
-        beginIdx = (int)str.length() - 1;
-        check = [](int i)
-        {
-            return i >= 0;
-        };
+        // set end offset to end of row
+        endOffset = mRow.length();
     }
-
-    // iterate through string
-    for (int i = beginIdx; check(i); i += step)
+    else if (static_cast<size_t>(mColsCounter) < mSemicolons.size())
     {
-        // iterate to character group
-        for (int j = 0; j < strlen(charGroup); j++)
-        {
-            if (str[i] == charGroup[j])
-            {
-                if (front)
-                {
-                    if (eraseStart == -1)
-                    {
-                        eraseStart = i;
-                    }
-                    eraseEnd = i;
-                }
-                else
-                {
-                    if (eraseEnd == -1)
-                    {
-                        eraseEnd = i;
-                    }
-                    eraseStart = i;
-                }
-                break;
-            }
-        }
-        // exit condition
-        if (eraseEnd != i && eraseStart != i)
-        {
-            break;
-        }
+        // end at next semicolon
+        endOffset = mSemicolons[mColsCounter];
     }
-    if (eraseStart != -1)
+    else
+    {
+        throw std::runtime_error("Can't find cell");
+    }
+
+    if (startOffset == endOffset)
     {
-        str.erase(eraseStart, eraseEnd + 1);
+        throw std::runtime_error("Can't find cell");
     }
+
+    // increment columns counter
+    mColsCounter++;
+
+    // view of cell
+    return mRow.substr(startOffset, endOffset - startOffset);
+}
+
+std::string_view IFileReader::extractTrimmed() noexcept(false)
+{
+    // remove whitespaces & tabs from front and newline from back
+    return CsvTokenizer::trim(this->extract());
 }
@@ -12,10 +12,31 @@
 #pragma once
 
 #include <fstream>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Failure of single row within batch
+ */
+struct RowError
+{
+    /**
+     * @brief number of failed row (first row is 1)
+     */
+    size_t row;
+    /**
+     * @brief number of failed column (first column is 1)
+     */
+    int column;
+    /**
+     * @brief reason of failure
+     */
+    std::string reason;
+};
 
 /**
  * @brief File Reader Interface class
@@ -52,6 +73,13 @@ public:
      * @return false - EOF
      */
     virtual bool read(std::string* line = nullptr) noexcept(false) = 0;
+    /**
+     * @brief Method which tells whether rows (and views of their cells) outlive next read
+     *
+     * @return true - rows stay valid while file is opened (i.e. whole file is in memory)
+     * @return false - rows are valid until next read
+     */
+    virtual bool keepsRows() const;
 
     /**
      * @brief Method which extracts cell from line, expecting decimal number
@@ -61,7 +89,7 @@ public:
      * @param[in] validate - external validation function (optional/nullable)
      * @return double - data within cell converted in double
      */
-    double extractDouble(std::function<bool(const std::string&, std::string&)> validate = nullptr) noexcept(false);
+    double extractDouble(std::function<bool(std::string_view, std::string&)> validate = nullptr) noexcept(false);
     /**
      * @brief Method which extracts cell from line, expecting decimal number
      *
@@ -70,7 +98,7 @@ public:
      * @param[in] validate - external validation function (optional/nullable)
      * @return float - data within cell converted in float
      */
-    float extractFloat(std::function<bool(const std::string&, std::string&)> validate = nullptr) noexcept(false);
+    float extractFloat(std::function<bool(std::string_view, std::string&)> validate = nullptr) noexcept(false);
     /**
      * @brief Method which extracts cell from line, expecting positive number (or zero)
      *
@@ -79,17 +107,63 @@ public:
      * @param[in] validate - external validation function (optional/nullable)
      * @return uint64_t - data within cell converted in uint64_t
      */
-    uint64_t extractULongLong(std::function<bool(const std::string&, std::string&)> validate = nullptr) noexcept(false);
+    uint64_t extractULongLong(std::function<bool(std::string_view, std::string&)> validate = nullptr) noexcept(false);
     /**
-     * @brief Method which extracts cell from line and places it into string
+     * @brief Method which extracts cell from line and places it into string.
+     *        Use it only when cell shall outlive current row, otherwise use extractStringView.
      *
      * @exception std::runtime_error on external validation failure
      *
      * @param[in] validate - external validation function (optional/nullable)
      * @return std::string - data within cell converted in string format
      */
-    std::string extractString(std::function<bool(const std::string&, std::string&)> validate = nullptr) noexcept(false);
+    std::string extractString(std::function<bool(std::string_view, std::string&)> validate = nullptr) noexcept(false);
+    /**
+     * @brief Method which extracts cell from line without copying it
+     *
+     * @exception std::runtime_error on external validation failure
+     *
+     * @param[in] validate - external validation function (optional/nullable)
+     * @return std::string_view - trimmed cell, valid until next read
+     */
+    std::string_view extractStringView(std::function<bool(std::string_view, std::string&)> validate = nullptr) noexcept(false);
 
+    /**
+     * @brief Method which reads & decodes batch of rows into columns (struct of arrays).
+     *        Decoded rows are stored densely, failed rows are skipped & reported.
+     *        Returns less rows than columns can hold only on EOF.
+     *
+     * @exception std::runtime_error if file is not opened
+     *
+     * @tparam Schema - RowSchema of rows
+     * @param[out] errors - failed rows (appended)
+     * @param[out] columns - one span (or vector) per schema column, batch size is the smallest of them
+     * @return size_t - number of decoded rows
+     */
+    template <typename Schema, typename... Columns>
+    size_t readBatch(std::vector<RowError>& errors, Columns&&... columns) noexcept(false)
+    {
+        return Schema::readBatch(*this, errors, std::forward<Columns>(columns)...);
+    }
+
+    /**
+     * @brief Get the current row
+     *
+     * @return std::string_view - current row without newline, valid until next read
+     */
+    std::string_view getRow() const;
+    /**
+     * @brief Get the offsets of semicolons within current row
+     *
+     * @return const std::vector<uint32_t>& - ascending offsets, valid until next read
+     */
+    const std::vector<uint32_t>& getSemicolons() const;
+    /**
+     * @brief Get the number of current row
+     *
+     * @return size_t - number of rows read since file was opened (first row is 1)
+     */
+    size_t getRowNum() const;
     /**
      * @brief Get the number of columns
      *
@@ -103,37 +177,48 @@ public:
      */
     void setNumOfCols(int num);
 protected:
-    /**
-     * @brief file reader
-     */
-    std::ifstream mReader;
     /**
      * @brief number of columns within a row/line 
      */
     int mNumOfCols = 0;
-
     /**
-     * @brief regex internal validator for positive numbers
+     * @brief current row, set by read of derived reader (points into reader's storage)
+     */
+    std::string_view mRow;
+    /**
+     * @brief offsets of semicolons within current row (filled by CsvTokenizer on every read)
      */
-    inline static const std::regex cPositiveNumReg = std::regex(R"(^[0-9]+$)");
+    std::vector<uint32_t> mSemicolons;
     /**
-     * @brief regex internal validator for positive decimal number
+     * @brief counter of extracted columns
      */
-    inline static const std::regex cPositiveDecReg = std::regex(R"(^[+]?[0-9]*(?:\.[0-9]*)?$)");
+    int mColsCounter = 0;
+    /**
+     * @brief counter of read rows
+     */
+    size_t mRowNum = 0;
 
+    /**
+     * @brief Method which sets current row, finds its semicolons & resets columns counter
+     *
+     * @param[in] row - row without newline (shall stay valid until next read)
+     */
+    void setRow(std::string_view row);
     /**
      * @brief Method which extracts cell from line and leaves it in raw (including whitespaces, etc.)
      *
-     * @return std::string extracted cell
+     * @exception std::runtime_error if there is no more cells within row
+     *
+     * @return std::string_view extracted cell (points into current row)
      */
-    virtual std::string extract() noexcept(false) = 0;
-
+    std::string_view extract() noexcept(false);
     /**
-     * @brief Erase special characters from string (from front or back of string)
+     * @brief Method which extracts cell from line and trims whitespaces, tabs & newline around it
+     *
+     * @exception std::runtime_error if there is no more cells within row
      *
-     * @param[out] str - string to be processed
-     * @param[in]  charGroup - group of special characters
-     * @param[in]  front - erase from front or back
+     * @return std::string_view trimmed cell (points into current row)
      */
-    void eraseCharactersFromString(std::string& str, const char* charGroup, bool front);
+    std::string_view extractTrimmed() noexcept(false);
+
 };
@@ -0,0 +1,148 @@
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "MappedFile.h"
+
+MappedFile::~MappedFile()
+{
+    this->close();
+}
+
+#ifdef _WIN32
+void MappedFile::open(const std::string& filename) noexcept(false)
+{
+    LARGE_INTEGER size;
+    HANDLE file;
+    HANDLE mapping;
+
+    // unmap previous file
+    this->close();
+
+    file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("Failed to open file " + filename);
+    }
+
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        throw std::runtime_error("Failed to get size of file " + filename);
+    }
+
+    // empty file can't be mapped, but it's valid
+    if (size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        mOpened = true;
+        return;
+    }
+
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+    {
+        throw std::runtime_error("Failed to map file " + filename);
+    }
+
+    // view keeps mapping alive after closing of handle
+    mData = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (!mData)
+    {
+        throw std::runtime_error("Failed to map file " + filename);
+    }
+
+    mSize = static_cast<size_t>(size.QuadPart);
+    mOpened = true;
+}
+
+void MappedFile::close()
+{
+    if (mData)
+    {
+        UnmapViewOfFile(mData);
+    }
+    mData = nullptr;
+    mSize = 0;
+    mOpened = false;
+}
+#else
+void MappedFile::open(const std::string& filename) noexcept(false)
+{
+    struct stat info;
+    void* data;
+    int fd;
+
+    // unmap previous file
+    this->close();
+
+    fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw std::runtime_error("Failed to open file " + filename);
+    }
+
+    if (fstat(fd, &info) == -1 || !S_ISREG(info.st_mode))
+    {
+        ::close(fd);
+        throw std::runtime_error("Failed to open file " + filename);
+    }
+
+    // empty file can't be mapped, but it's valid
+    if (info.st_size == 0)
+    {
+        ::close(fd);
+        mOpened = true;
+        return;
+    }
+
+    data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw std::runtime_error("Failed to map file " + filename);
+    }
+
+    // file is walked from front to back
+    madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    mData = static_cast<const char*>(data);
+    mSize = static_cast<size_t>(info.st_size);
+    mOpened = true;
+}
+
+void MappedFile::close()
+{
+    if (mData)
+    {
+        munmap(const_cast<char*>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+    mOpened = false;
+}
+#endif
+
+bool MappedFile::isOpen() const
+{
+    return mOpened;
+}
+
+const char* MappedFile::data() const
+{
+    return mData;
+}
+
+size_t MappedFile::size() const
+{
+    return mSize;
+}
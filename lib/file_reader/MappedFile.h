@@ -0,0 +1,78 @@
+/**
+ * @file MappedFile.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief MappedFile class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Read-only memory mapped file
+ *        maps whole file into the address space, so it can be walked in place
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Construct a new MappedFile object
+     */
+    explicit MappedFile() = default;
+    /**
+     * @brief Destroy the MappedFile object (unmaps file)
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Method which tries to map file (previously mapped file gets unmapped)
+     *
+     * @exception std::runtime_error - if mapping of file has failed
+     *
+     * @param[in] filename - file to map
+     */
+    void open(const std::string& filename) noexcept(false);
+    /**
+     * @brief Method which unmaps file
+     */
+    void close();
+
+    /**
+     * @brief Check is file mapped
+     *
+     * @return true - file is mapped
+     * @return false - file is not mapped
+     */
+    bool isOpen() const;
+    /**
+     * @brief Get the beginning of mapped file
+     *
+     * @return const char* - first byte of file (NULL if file is empty)
+     */
+    const char* data() const;
+    /**
+     * @brief Get the size of mapped file
+     *
+     * @return size_t - size in bytes
+     */
+    size_t size() const;
+private:
+    /**
+     * @brief mapped memory & its size
+     */
+    const char* mData = nullptr;
+    size_t mSize = 0;
+    /**
+     * @brief opened flag (empty file is opened, but not mapped)
+     */
+    bool mOpened = false;
+};
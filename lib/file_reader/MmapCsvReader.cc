@@ -0,0 +1,80 @@
+#include <stdexcept>
+
+#include "MmapCsvReader.h"
+#include "CsvTokenizer.h"
+
+#define CSV_EXTENSION ".csv"
+#define CSV_EXTENSION_LEN 4
+
+void MmapCsvReader::open(std::string filename) noexcept(false)
+{
+    // validate format (extension) of file
+    if (filename.find(CSV_EXTENSION) != filename.length() - CSV_EXTENSION_LEN)
+    {
+        throw std::runtime_error("Bad format (extension) for file " + filename);
+    }
+
+    // reset row cursor
+    mFileOffset = mFileEnd = mRowNum = 0;
+    mRow = std::string_view();
+
+    // map file (previous one gets unmapped once no other reader shares it)
+    std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+    mFile.reset();
+    file->open(filename);
+
+    mFile = file;
+    mFileEnd = file->size();
+}
+
+void MmapCsvReader::openRange(std::shared_ptr<const MappedFile> file, size_t begin, size_t end)
+{
+    mFile = file;
+    mFileOffset = begin;
+    mFileEnd = end;
+    mRowNum = 0;
+    mRow = std::string_view();
+}
+
+std::shared_ptr<const MappedFile> MmapCsvReader::getMappedFile() const
+{
+    return mFile;
+}
+
+bool MmapCsvReader::keepsRows() const
+{
+    return true;
+}
+
+bool MmapCsvReader::read(std::string* line) noexcept(false)
+{
+    if (!mFile || !mFile->isOpen())
+    {
+        throw std::runtime_error("Can't read row because file is not opened.");
+    }
+
+    // check EOF
+    if (mFileOffset >= mFileEnd)
+    {
+        this->setRow(std::string_view());
+        return false;
+    }
+
+    // search for the end of row & its semicolons in place (in single pass)
+    const char* rowBegin = mFile->data() + mFileOffset;
+    const size_t remaining = mFileEnd - mFileOffset;
+    const size_t rowLength = CsvTokenizer::scanRow(rowBegin, remaining, mSemicolons);
+
+    // newline is not part of row (same as std::getline)
+    mRow = std::string_view(rowBegin, rowLength);
+    mColsCounter = 0;
+    mRowNum++;
+    mFileOffset += (rowLength < remaining) ? rowLength + 1 : rowLength;
+
+    // assign to output if it's possible
+    if (line)
+    {
+        line->assign(mRow);
+    }
+    return true;
+}
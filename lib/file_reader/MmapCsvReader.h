@@ -0,0 +1,88 @@
+/**
+ * @file MmapCsvReader.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief MmapCsvReader class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <string_view>
+#include <memory>
+
+#include "IFileReader.h"
+#include "MappedFile.h"
+
+/**
+ * @brief Memory mapped CSV File Reader class
+ *        maps the whole file and walks rows in place, without copying them into row storage
+ */
+class MmapCsvReader : public IFileReader
+{
+public:
+    /**
+     * @brief Construct a new MmapCsvReader object
+     */
+    explicit MmapCsvReader() = default;
+    /**
+     * @brief Destroy the MmapCsvReader object
+     */
+    ~MmapCsvReader() = default;
+
+    /**
+     * @brief Method which tries to open (map) file
+     *
+     * @exception std::runtime_error - if open file has failed
+     *
+     * @param[in] filename - file to read
+     */
+    void open(std::string filename) noexcept(false) override;
+    /**
+     * @brief Method which reads line within mapped file.
+     *        It shall read next line every time until EOF.
+     *
+     * @exception std::runtime_error if file is not opened
+     *
+     * @param[out] line - external storage for readen line (optional/nullable)
+     * @return true - line succesfully read
+     * @return false - EOF
+     */
+    bool read(std::string* line = nullptr) noexcept(false) override;
+    /**
+     * @brief Method which tells that rows outlive next read (they point into mapped file)
+     *
+     * @return true - always
+     */
+    bool keepsRows() const override;
+    /**
+     * @brief Method which opens part of already mapped file (i.e. chunk parsed by another thread)
+     *
+     * @param[in] file - mapped file shared between readers
+     * @param[in] begin - offset of first row within file
+     * @param[in] end - offset behind last row within file
+     */
+    void openRange(std::shared_ptr<const MappedFile> file, size_t begin, size_t end);
+    /**
+     * @brief Get the mapped file, so it can be shared with readers of its parts
+     *
+     * @return std::shared_ptr<const MappedFile> - mapped file (NULL if file is not opened)
+     */
+    std::shared_ptr<const MappedFile> getMappedFile() const;
+private:
+    /**
+     * @brief mapped file
+     */
+    std::shared_ptr<const MappedFile> mFile;
+    /**
+     * @brief offset of the next row within mapped file
+     */
+    size_t mFileOffset = 0;
+    /**
+     * @brief offset behind last row to read
+     */
+    size_t mFileEnd = 0;
+};
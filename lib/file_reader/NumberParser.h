@@ -0,0 +1,219 @@
+/**
+ * @file NumberParser.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Regex-free, locale independent number parsing of CSV cells
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+/**
+ * @brief Result of cell parsing
+ */
+enum class ParseStatus
+{
+    /**
+     * @brief cell is converted
+     */
+    Ok,
+    /**
+     * @brief cell doesn't match number format (former regex validation)
+     */
+    NotNumber,
+    /**
+     * @brief cell matches format, but contains no digits (i.e. "", "+", ".")
+     */
+    NoConversion,
+    /**
+     * @brief number doesn't fit into requested type
+     */
+    OutOfRange
+};
+
+/**
+ * @brief Parses positive number (or zero), format: [0-9]+
+ *
+ * @param[in] cell - trimmed cell
+ * @param[out] value - converted number (valid only on ParseStatus::Ok)
+ * @return ParseStatus - parsing result
+ */
+inline ParseStatus parseNatural(std::string_view cell, uint64_t& value)
+{
+    const char* end = cell.data() + cell.length();
+    const std::from_chars_result result = std::from_chars(cell.data(), end, value);
+
+    // every character shall be digit & there shall be at least one of them
+    if (result.ptr != end || result.ec == std::errc::invalid_argument)
+    {
+        return ParseStatus::NotNumber;
+    }
+    if (result.ec == std::errc::result_out_of_range)
+    {
+        return ParseStatus::OutOfRange;
+    }
+    return ParseStatus::Ok;
+}
+
+/**
+ * @brief Parses positive decimal number, format: [+]?[0-9]*(\.[0-9]*)?
+ *
+ * @param[in] cell - trimmed cell
+ * @param[out] value - converted number (valid only on ParseStatus::Ok)
+ * @return ParseStatus - parsing result
+ */
+template <typename T>
+inline ParseStatus parseDecimal(std::string_view cell, T& value)
+{
+    // optional plus sign, from_chars doesn't accept it
+    if (!cell.empty() && cell.front() == '+')
+    {
+        cell.remove_prefix(1);
+    }
+
+    // digits & dot are the only valid starts (rejects sign, "inf", "nan")
+    if (!cell.empty() && cell.front() != '.' && (cell.front() < '0' || cell.front() > '9'))
+    {
+        return ParseStatus::NotNumber;
+    }
+
+    const char* end = cell.data() + cell.length();
+    const std::from_chars_result result = std::from_chars(cell.data(), end, value, std::chars_format::fixed);
+
+    if (result.ec == std::errc::invalid_argument)
+    {
+        // empty cell & lonely dot match format, but they aren't numbers
+        return (cell.empty() || cell == ".") ? ParseStatus::NoConversion : ParseStatus::NotNumber;
+    }
+    if (result.ptr != end)
+    {
+        return ParseStatus::NotNumber;
+    }
+    // strto* family reports subnormal results as range error, keep the same behaviour
+    if (result.ec == std::errc::result_out_of_range || std::fpclassify(value) == FP_SUBNORMAL)
+    {
+        return ParseStatus::OutOfRange;
+    }
+    return ParseStatus::Ok;
+}
+
+/**
+ * @brief Parses positive decimal number into fixed point integer, format: [+]?[0-9]*(\.[0-9]*)?
+ *        Fraction digits beyond precision are rounded half up (i.e. "1.235" -> 124 with 2 digits).
+ *
+ * @param[in] cell - trimmed cell
+ * @param[in] digits - number of fraction digits kept within value
+ * @param[out] value - converted number multiplied by 10^digits (valid only on ParseStatus::Ok)
+ * @return ParseStatus - parsing result
+ */
+inline ParseStatus parseFixedPoint(std::string_view cell, int digits, int64_t& value)
+{
+    bool hasDigits = false;
+    bool overflow = false;
+    bool roundUp = false;
+    int fractionDigits = 0;
+    size_t i = 0;
+
+    // appends decimal digit to value, overflow is reported once whole cell is validated
+    auto append = [&value, &overflow](int digit)
+    {
+        if (value > (INT64_MAX - digit) / 10)
+        {
+            overflow = true;
+            return;
+        }
+        value = value * 10 + digit;
+    };
+
+    // optional plus sign
+    if (i < cell.length() && cell[i] == '+')
+    {
+        i++;
+    }
+
+    // integer part
+    value = 0;
+    for (; i < cell.length() && cell[i] >= '0' && cell[i] <= '9'; i++)
+    {
+        append(cell[i] - '0');
+        hasDigits = true;
+    }
+
+    // fraction part, the first dropped digit decides rounding
+    if (i < cell.length() && cell[i] == '.')
+    {
+        for (i++; i < cell.length() && cell[i] >= '0' && cell[i] <= '9'; i++)
+        {
+            if (fractionDigits < digits)
+            {
+                append(cell[i] - '0');
+            }
+            else if (fractionDigits == digits)
+            {
+                roundUp = cell[i] >= '5';
+            }
+            fractionDigits++;
+            hasDigits = true;
+        }
+    }
+
+    if (i != cell.length())
+    {
+        return ParseStatus::NotNumber;
+    }
+    if (!hasDigits)
+    {
+        // empty cell, lonely sign & lonely dot match format, but they aren't numbers
+        return ParseStatus::NoConversion;
+    }
+
+    // pad missing fraction digits with zeros
+    for (; fractionDigits < digits; fractionDigits++)
+    {
+        append(0);
+    }
+    if (roundUp && !overflow)
+    {
+        overflow = (value == INT64_MAX);
+        value += (overflow) ? 0 : 1;
+    }
+    return (overflow) ? ParseStatus::OutOfRange : ParseStatus::Ok;
+}
+
+/**
+ * @brief Throws exception which matches parsing failure
+ *
+ * @exception std::runtime_error cell doesn't match number format
+ * @exception std::invalid_argument if no conversion could be performed
+ * @exception std::out_of_range if converted value is out of range
+ *
+ * @param[in] status - parsing result (nothing is thrown for ParseStatus::Ok)
+ * @param[in] cell - parsed cell
+ * @param[in] format - expected format reported within runtime_error (i.e. "decimal number")
+ * @param[in] conversion - name of conversion reported within invalid_argument/out_of_range (i.e. "stod")
+ */
+inline void throwOnParseFailure(ParseStatus status, std::string_view cell, const char* format, const char* conversion) noexcept(false)
+{
+    switch (status)
+    {
+    case ParseStatus::NotNumber:
+        throw std::runtime_error('"' + std::string(cell) + '"' + " is not a " + format + ".");
+    case ParseStatus::NoConversion:
+        throw std::invalid_argument(conversion);
+    case ParseStatus::OutOfRange:
+        throw std::out_of_range(conversion);
+    default:
+        break;
+    }
+}
@@ -0,0 +1,47 @@
+#include <string>
+
+#include "RowErrorReport.h"
+#include "RowException.h"
+
+RowErrorReport::RowErrorReport(size_t budget) :
+    mBudget{budget}
+{
+
+}
+
+void RowErrorReport::add(const std::vector<RowError>& errors, size_t firstRow) noexcept(false)
+{
+    for (const RowError& error : errors)
+    {
+        if (mErrors.size() >= mBudget)
+        {
+            // strict deserialization reports the row only
+            if (mBudget == 0)
+            {
+                throw RowException(firstRow + error.row, error.reason);
+            }
+            throw RowException(firstRow + error.row, error.reason + " (error budget of " + std::to_string(mBudget) + " rows exceeded)");
+        }
+        mErrors.push_back(RowError{firstRow + error.row, error.column, error.reason});
+    }
+}
+
+void RowErrorReport::clear()
+{
+    mErrors.clear();
+}
+
+const std::vector<RowError>& RowErrorReport::getErrors() const
+{
+    return mErrors;
+}
+
+size_t RowErrorReport::getBudget() const
+{
+    return mBudget;
+}
+
+void RowErrorReport::setBudget(size_t budget)
+{
+    mBudget = budget;
+}
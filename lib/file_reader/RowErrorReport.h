@@ -0,0 +1,74 @@
+/**
+ * @file RowErrorReport.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief RowErrorReport class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "IFileReader.h"
+
+/**
+ * @brief Report of malformed rows skipped during deserialization.
+ *        Error budget limits number of skipped rows, budget 0 means strict deserialization (the first malformed row fails).
+ */
+class RowErrorReport
+{
+public:
+    /**
+     * @brief Construct a new RowErrorReport object
+     *
+     * @param[in] budget - maximal number of skipped rows
+     */
+    explicit RowErrorReport(size_t budget = 0);
+
+    /**
+     * @brief Method which records failed rows
+     *
+     * @exception RowException on the first failed row beyond error budget
+     *
+     * @param[in] errors - failed rows
+     * @param[in] firstRow - number of rows preceding the rows of errors (i.e. rows of previous chunks)
+     */
+    void add(const std::vector<RowError>& errors, size_t firstRow = 0) noexcept(false);
+    /**
+     * @brief Method which removes every recorded row (budget stays the same)
+     */
+    void clear();
+
+    /**
+     * @brief Get the failed rows
+     *
+     * @return const std::vector<RowError>& - failed rows in the order of recording
+     */
+    const std::vector<RowError>& getErrors() const;
+    /**
+     * @brief Get the error budget
+     *
+     * @return size_t - maximal number of skipped rows
+     */
+    size_t getBudget() const;
+    /**
+     * @brief Set the error budget
+     *
+     * @param[in] budget - maximal number of skipped rows (0 means strict deserialization)
+     */
+    void setBudget(size_t budget);
+private:
+    /**
+     * @brief maximal number of skipped rows
+     */
+    size_t mBudget;
+    /**
+     * @brief skipped rows
+     */
+    std::vector<RowError> mErrors;
+};
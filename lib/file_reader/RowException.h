@@ -0,0 +1,57 @@
+/**
+ * @file RowException.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief RowException class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Exception which reports failed row of file (i.e. "Row 3: "x" is not a decimal number.")
+ */
+class RowException : public std::runtime_error
+{
+public:
+    /**
+     * @brief Construct a new RowException object
+     *
+     * @param[in] row - number of failed row (first row is 1)
+     * @param[in] reason - reason of failure
+     */
+    RowException(size_t row, const std::string& reason) :
+        std::runtime_error("Row " + std::to_string(row) + ": " + reason),
+        mRow{row},
+        mReason{reason}
+    {
+    }
+
+    /**
+     * @brief Get the number of failed row
+     *
+     * @return size_t - row number
+     */
+    size_t getRow() const { return mRow; }
+    /**
+     * @brief Get the reason of failure (without row number)
+     *
+     * @return const std::string& - reason
+     */
+    const std::string& getReason() const { return mReason; }
+private:
+    /**
+     * @brief failed row
+     */
+    size_t mRow;
+    /**
+     * @brief reason of failure
+     */
+    std::string mReason;
+};
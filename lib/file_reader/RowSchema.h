@@ -0,0 +1,412 @@
+/**
+ * @file RowSchema.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Compile-time typed row decoding (RowSchema & column definitions)
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "IFileReader.h"
+#include "CsvTokenizer.h"
+#include "NumberParser.h"
+
+#define EAN13_LEN 13
+
+/**
+ * @brief Result of cell decoding
+ */
+enum class CellStatus
+{
+    /**
+     * @brief cell is decoded
+     */
+    Ok,
+    /**
+     * @brief cell is missing or empty
+     */
+    Missing,
+    /**
+     * @brief cell doesn't match number format
+     */
+    NotNumber,
+    /**
+     * @brief cell doesn't meet requirement of column (i.e. length of EAN 13)
+     */
+    Invalid,
+    /**
+     * @brief cell matches format, but contains no digits
+     */
+    NoConversion,
+    /**
+     * @brief number doesn't fit into column type
+     */
+    OutOfRange
+};
+
+/**
+ * @brief Texts which describe failed cell of column
+ */
+struct CellFormat
+{
+    /**
+     * @brief expected format (i.e. "decimal number")
+     */
+    const char* name;
+    /**
+     * @brief name of conversion (i.e. "stod")
+     */
+    const char* conversion;
+    /**
+     * @brief additional requirement (i.e. "EAN13 shall be 13 digits long.")
+     */
+    const char* requirement;
+};
+
+/**
+ * @brief Converts number parsing result into cell decoding result
+ *
+ * @param[in] status - number parsing result
+ * @return CellStatus - cell decoding result
+ */
+inline CellStatus toCellStatus(ParseStatus status)
+{
+    switch (status)
+    {
+    case ParseStatus::Ok:
+        return CellStatus::Ok;
+    case ParseStatus::NotNumber:
+        return CellStatus::NotNumber;
+    case ParseStatus::NoConversion:
+        return CellStatus::NoConversion;
+    default:
+        return CellStatus::OutOfRange;
+    }
+}
+
+/**
+ * @brief Throws exception which matches failed cell (same as IFileReader::extract* does)
+ *
+ * @exception std::runtime_error cell is missing, doesn't match format or requirement of column
+ * @exception std::invalid_argument if no conversion could be performed
+ * @exception std::out_of_range if converted value is out of range
+ *
+ * @param[in] status - decoding result (nothing is thrown for CellStatus::Ok)
+ * @param[in] cell - failed cell
+ * @param[in] format - texts of column
+ */
+inline void throwOnCellFailure(CellStatus status, std::string_view cell, const CellFormat& format) noexcept(false)
+{
+    switch (status)
+    {
+    case CellStatus::Missing:
+        throw std::runtime_error("Can't find cell");
+    case CellStatus::NotNumber:
+        throwOnParseFailure(ParseStatus::NotNumber, cell, format.name, format.conversion);
+        break;
+    case CellStatus::Invalid:
+        throw std::runtime_error('"' + std::string(cell) + '"' + " is not valid. " + format.requirement);
+    case CellStatus::NoConversion:
+        throwOnParseFailure(ParseStatus::NoConversion, cell, format.name, format.conversion);
+        break;
+    case CellStatus::OutOfRange:
+        throwOnParseFailure(ParseStatus::OutOfRange, cell, format.name, format.conversion);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Describes failed cell without throwing, text matches what() of throwOnCellFailure exception
+ *
+ * @param[in] status - decoding result
+ * @param[in] cell - failed cell
+ * @param[in] format - texts of column
+ * @return std::string - reason of failure (empty for CellStatus::Ok)
+ */
+inline std::string describeCellFailure(CellStatus status, std::string_view cell, const CellFormat& format)
+{
+    switch (status)
+    {
+    case CellStatus::Missing:
+        return "Can't find cell";
+    case CellStatus::NotNumber:
+        return '"' + std::string(cell) + '"' + " is not a " + format.name + ".";
+    case CellStatus::Invalid:
+        return '"' + std::string(cell) + '"' + " is not valid. " + format.requirement;
+    case CellStatus::NoConversion:
+    case CellStatus::OutOfRange:
+        return format.conversion;
+    default:
+        return std::string();
+    }
+}
+
+/**
+ * @brief EAN 13 column, 13 digits long natural number
+ */
+struct Ean13Column
+{
+    using Type = uint64_t;
+    static constexpr CellFormat Format = {"natural number", "stoull", "EAN13 shall be 13 digits long."};
+
+    /**
+     * @brief Decodes trimmed cell
+     */
+    static CellStatus decode(std::string_view cell, Type& value) noexcept
+    {
+        const ParseStatus status = parseNatural(cell, value);
+        if (status == ParseStatus::NotNumber)
+        {
+            return CellStatus::NotNumber;
+        }
+        if (cell.length() != EAN13_LEN)
+        {
+            return CellStatus::Invalid;
+        }
+        return toCellStatus(status);
+    }
+};
+
+/**
+ * @brief String column, decoded as view into current row (copy it if it shall outlive the row)
+ */
+struct StringColumn
+{
+    using Type = std::string_view;
+    static constexpr CellFormat Format = {"string", "", ""};
+
+    /**
+     * @brief Decodes trimmed cell
+     */
+    static CellStatus decode(std::string_view cell, Type& value) noexcept
+    {
+        value = cell;
+        return CellStatus::Ok;
+    }
+};
+
+/**
+ * @brief String column, decoded as copy of cell (for batches of readers which don't keep rows, i.e. CsvReader)
+ */
+struct OwnedStringColumn
+{
+    using Type = std::string;
+    static constexpr CellFormat Format = {"string", "", ""};
+
+    /**
+     * @brief Decodes trimmed cell
+     */
+    static CellStatus decode(std::string_view cell, Type& value)
+    {
+        value.assign(cell);
+        return CellStatus::Ok;
+    }
+};
+
+/**
+ * @brief Decimal number column converted into double
+ */
+struct DoubleColumn
+{
+    using Type = double;
+    static constexpr CellFormat Format = {"decimal number", "stod", ""};
+
+    /**
+     * @brief Decodes trimmed cell
+     */
+    static CellStatus decode(std::string_view cell, Type& value) noexcept
+    {
+        return toCellStatus(parseDecimal(cell, value));
+    }
+};
+
+/**
+ * @brief Decimal number column converted into float
+ */
+struct FloatColumn
+{
+    using Type = float;
+    static constexpr CellFormat Format = {"decimal number", "stof", ""};
+
+    /**
+     * @brief Decodes trimmed cell
+     */
+    static CellStatus decode(std::string_view cell, Type& value) noexcept
+    {
+        return toCellStatus(parseDecimal(cell, value));
+    }
+};
+
+/**
+ * @brief Decimal number column converted into fixed point number (i.e. Money)
+ *
+ * @tparam FixedPoint - type which provides NumOfDigits, MaxMinorUnits & static fromMinorUnits(int64_t)
+ */
+template <typename FixedPoint>
+struct FixedPointColumn
+{
+    using Type = FixedPoint;
+    static constexpr CellFormat Format = {"decimal number", "fixed point", ""};
+
+    /**
+     * @brief Decodes trimmed cell, fraction digits beyond precision are rounded
+     */
+    static CellStatus decode(std::string_view cell, Type& value) noexcept
+    {
+        int64_t minorUnits;
+        const ParseStatus status = parseFixedPoint(cell, FixedPoint::NumOfDigits, minorUnits);
+        if (status != ParseStatus::Ok)
+        {
+            return toCellStatus(status);
+        }
+        if (minorUnits > FixedPoint::MaxMinorUnits)
+        {
+            return CellStatus::OutOfRange;
+        }
+        value = FixedPoint::fromMinorUnits(minorUnits);
+        return CellStatus::Ok;
+    }
+};
+
+/**
+ * @brief Row layout known at compile time (i.e. RowSchema<Ean13Column, StringColumn, DoubleColumn, FloatColumn>).
+ *        Decodes whole row of reader in single call, without virtual calls, std::function validators,
+ *        runtime number of columns or exceptions. Cells are split & trimmed the same way as IFileReader::extract* does.
+ *
+ * @tparam Columns - column definitions, every one provides Type, Format (CellFormat)
+ *                   & static CellStatus decode(std::string_view, Type&)
+ */
+template <typename... Columns>
+class RowSchema
+{
+public:
+    static_assert(sizeof...(Columns) > 0, "RowSchema shall have at least one column");
+
+    /**
+     * @brief number of columns within a row
+     */
+    static constexpr int NumOfCols = sizeof...(Columns);
+
+    /**
+     * @brief Decodes current row of reader, cells are decoded from left to right
+     *
+     * @exception std::runtime_error, std::invalid_argument, std::out_of_range - same as IFileReader::extract*
+     *
+     * @param[in] reader - reader with read row
+     * @param[out] values - one output per column
+     */
+    static void decode(const IFileReader& reader, typename Columns::Type&... values) noexcept(false)
+    {
+        int column = 0;
+        std::string_view cell;
+
+        const CellStatus status = decodeColumns(reader.getRow(), reader.getSemicolons(), std::index_sequence_for<Columns...>(), column, cell, values...);
+        if (status != CellStatus::Ok)
+        {
+            throwOnCellFailure(status, cell, Formats[column - 1]);
+        }
+    }
+
+    /**
+     * @brief Reads & decodes batch of rows into columns, see IFileReader::readBatch.
+     *        Failed rows are reported without any exception.
+     *
+     * @exception std::runtime_error if file is not opened
+     *
+     * @param[in] reader - opened file reader
+     * @param[out] errors - failed rows (appended)
+     * @param[out] columns - one span per column, batch size is the smallest of them
+     * @return size_t - number of decoded rows (less than batch size only on EOF)
+     */
+    static size_t readBatch(IFileReader& reader, std::vector<RowError>& errors, std::span<typename Columns::Type>... columns) noexcept(false)
+    {
+        const size_t batchSize = std::min({columns.size()...});
+        size_t decoded = 0;
+        int column = 0;
+        std::string_view cell;
+
+        while (decoded < batchSize && reader.read())
+        {
+            // failed row gets overwritten by next one
+            const CellStatus status = decodeColumns(reader.getRow(), reader.getSemicolons(), std::index_sequence_for<Columns...>(), column, cell, columns[decoded]...);
+            if (status == CellStatus::Ok)
+            {
+                decoded++;
+            }
+            else
+            {
+                errors.push_back(RowError{reader.getRowNum(), column, describeCellFailure(status, cell, Formats[column - 1])});
+            }
+        }
+        return decoded;
+    }
+private:
+    /**
+     * @brief texts of every column
+     */
+    static constexpr CellFormat Formats[] = {Columns::Format...};
+
+    /**
+     * @brief Decodes cells of row from left to right until the first failure
+     *
+     * @param[out] column - number of last decoded column (failed one on failure)
+     * @param[out] cell - last decoded cell (failed one on failure)
+     * @return CellStatus - result of last decoded cell
+     */
+    template <size_t... Indices>
+    static CellStatus decodeColumns(std::string_view row, const std::vector<uint32_t>& semicolons, std::index_sequence<Indices...>,
+                                    int& column, std::string_view& cell, typename Columns::Type&... values)
+    {
+        CellStatus status = CellStatus::Ok;
+
+        // && fold keeps order of columns & stops on the first failure
+        ((column = Indices + 1,
+          (status = extractCell<Indices>(row, semicolons, cell)) == CellStatus::Ok &&
+          (status = Columns::decode(cell, values)) == CellStatus::Ok) && ...);
+        return status;
+    }
+
+    /**
+     * @brief Extracts trimmed cell, the last one takes the rest of row
+     *
+     * @param[out] cell - trimmed cell
+     * @return CellStatus - CellStatus::Missing if cell can't be found
+     */
+    template <size_t Index>
+    static CellStatus extractCell(std::string_view row, const std::vector<uint32_t>& semicolons, std::string_view& cell) noexcept
+    {
+        const size_t begin = (Index == 0) ? 0 : semicolons[Index - 1] + 1;
+        size_t end = row.length();
+
+        if constexpr (Index != NumOfCols - 1)
+        {
+            if (Index >= semicolons.size())
+            {
+                return CellStatus::Missing;
+            }
+            end = semicolons[Index];
+        }
+
+        if (begin == end)
+        {
+            return CellStatus::Missing;
+        }
+        cell = CsvTokenizer::trim(row.substr(begin, end - begin));
+        return CellStatus::Ok;
+    }
+};
@@ -0,0 +1,613 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <chrono>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define ASYNC_IO_RING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include "AsyncIo.h"
+
+/**
+ * @brief maximal number of threads of thread pool backend
+ */
+#define ASYNC_IO_MAX_THREADS 16
+/**
+ * @brief initial buffer length of read file, doubled until whole file fits
+ */
+#define ASYNC_IO_READ_LEN (16 * 1024)
+#define ASYNC_IO_FILE_MODE 0644
+/**
+ * @brief number of probed requests (IORING_OP_* values)
+ */
+#define ASYNC_IO_PROBE_LEN 256
+/**
+ * @brief time of waiting for thread pool after fall back, before completions of io_uring are checked again
+ */
+#define ASYNC_IO_FALLBACK_WAIT_MS 1
+
+#ifdef ASYNC_IO_RING
+/**
+ * @brief io_uring set up with system calls (no liburing dependency).
+ *        Submission & completion rings are shared with kernel, kernel advances head of submissions
+ *        & tail of completions, this process advances the other two.
+ */
+struct AsyncIo::Ring
+{
+    int fd = -1;
+    unsigned entries = 0;
+    /**
+     * @brief number of requests within kernel (completion ring is twice longer, so it never overflows)
+     */
+    unsigned inFlight = 0;
+    /**
+     * @brief number of filled & not yet submitted entries
+     */
+    unsigned toSubmit = 0;
+
+    void* sqMap = MAP_FAILED;
+    size_t sqMapLen = 0;
+    void* cqMap = MAP_FAILED;
+    size_t cqMapLen = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesLen = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned sqMask = 0;
+    unsigned* sqArray = nullptr;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    ~Ring()
+    {
+        if (sqes != MAP_FAILED)
+        {
+            munmap(sqes, sqesLen);
+        }
+        if (cqMap != MAP_FAILED && cqMap != sqMap)
+        {
+            munmap(cqMap, cqMapLen);
+        }
+        if (sqMap != MAP_FAILED)
+        {
+            munmap(sqMap, sqMapLen);
+        }
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+    }
+
+    /**
+     * @brief Sets up ring & checks that kernel supports every used request
+     *
+     * @param[in] numOfEntries - number of submission entries
+     * @return true - ring is ready
+     * @return false - io_uring is unavailable
+     */
+    bool setup(unsigned numOfEntries)
+    {
+        io_uring_params params = {};
+
+        fd = static_cast<int>(syscall(__NR_io_uring_setup, numOfEntries, &params));
+        if (fd < 0)
+        {
+            return false;
+        }
+        entries = params.sq_entries;
+
+        // both rings may share single mapping
+        sqMapLen = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqMapLen = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            sqMapLen = cqMapLen = std::max(sqMapLen, cqMapLen);
+        }
+        sqMap = mmap(nullptr, sqMapLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sqMap == MAP_FAILED)
+        {
+            return false;
+        }
+        cqMap = (params.features & IORING_FEAT_SINGLE_MMAP) ? sqMap :
+                mmap(nullptr, cqMapLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (cqMap == MAP_FAILED)
+        {
+            return false;
+        }
+        sqesLen = params.sq_entries * sizeof(io_uring_sqe);
+        sqes = static_cast<io_uring_sqe*>(mmap(nullptr, sqesLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (sqes == MAP_FAILED)
+        {
+            return false;
+        }
+
+        char* const sq = static_cast<char*>(sqMap);
+        char* const cq = static_cast<char*>(cqMap);
+        sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        return probe();
+    }
+
+    /**
+     * @brief Checks that kernel supports open, read, write & close requests (added together in Linux 5.6)
+     */
+    bool probe()
+    {
+        std::vector<char> storage(sizeof(io_uring_probe) + ASYNC_IO_PROBE_LEN * sizeof(io_uring_probe_op));
+        io_uring_probe* const result = reinterpret_cast<io_uring_probe*>(storage.data());
+
+        if (syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, result, ASYNC_IO_PROBE_LEN) < 0)
+        {
+            return false;
+        }
+        for (const int opcode : {IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_WRITE, IORING_OP_CLOSE})
+        {
+            if (opcode > result->last_op || !(result->ops[opcode].flags & IO_URING_OP_SUPPORTED))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Fills submission entry of request
+     *
+     * @param[in] operation - request
+     * @return true - request is queued
+     * @return false - ring is full
+     */
+    bool push(IoOperation* operation)
+    {
+        const unsigned tail = *sqTail;
+        if (inFlight + toSubmit >= entries || tail - std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire) >= entries)
+        {
+            return false;
+        }
+
+        const unsigned index = tail & sqMask;
+        io_uring_sqe& sqe = sqes[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.user_data = reinterpret_cast<uint64_t>(operation);
+        switch (operation->mKind)
+        {
+        case IoOperation::Kind::Open:
+            sqe.opcode = IORING_OP_OPENAT;
+            sqe.fd = AT_FDCWD;
+            sqe.addr = reinterpret_cast<uint64_t>(operation->mPath);
+            sqe.len = operation->mMode;
+            sqe.open_flags = static_cast<uint32_t>(operation->mFlags);
+            break;
+        case IoOperation::Kind::Read:
+        case IoOperation::Kind::Write:
+            sqe.opcode = (operation->mKind == IoOperation::Kind::Read) ? IORING_OP_READ : IORING_OP_WRITE;
+            sqe.fd = operation->mFd;
+            sqe.addr = reinterpret_cast<uint64_t>(operation->mBuffer);
+            sqe.len = static_cast<uint32_t>(std::min<size_t>(operation->mLength, INT_MAX));
+            sqe.off = operation->mOffset;
+            break;
+        case IoOperation::Kind::Close:
+            sqe.opcode = IORING_OP_CLOSE;
+            sqe.fd = operation->mFd;
+            break;
+        }
+        sqArray[index] = index;
+
+        // entry shall be visible to kernel before tail
+        std::atomic_ref<unsigned>(*sqTail).store(tail + 1, std::memory_order_release);
+        toSubmit++;
+        return true;
+    }
+
+    /**
+     * @brief Submits queued entries & waits for at least one completion
+     *
+     * @return int - 0 or negative errno if io_uring can't be used anymore
+     */
+    int submitAndWait()
+    {
+        while (true)
+        {
+            const int submitted = static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0));
+            if (submitted >= 0)
+            {
+                toSubmit -= static_cast<unsigned>(submitted);
+                inFlight += static_cast<unsigned>(submitted);
+                return 0;
+            }
+            if (errno == EBUSY || errno == EAGAIN)
+            {
+                // completions shall be reaped first (or kernel is short of resources for a while)
+                return 0;
+            }
+            if (errno != EINTR)
+            {
+                return -errno;
+            }
+        }
+    }
+
+    /**
+     * @brief Waits for at least one completion without submitting anything
+     *
+     * @return int - 0 or negative errno
+     */
+    int wait()
+    {
+        while (syscall(__NR_io_uring_enter, fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0)
+        {
+            if (errno != EINTR)
+            {
+                return -errno;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Takes back filled entries which kernel hasn't submitted yet
+     *
+     * @param[out] operations - requests of entries (in order of submission)
+     */
+    void takeUnsubmitted(std::deque<IoOperation*>& operations)
+    {
+        // kernel reads entries behind its head only within io_uring_enter, so tail moves back over them
+        const unsigned head = std::atomic_ref<unsigned>(*sqHead).load(std::memory_order_acquire);
+        unsigned tail = *sqTail;
+        for (; tail != head; tail--)
+        {
+            operations.push_front(reinterpret_cast<IoOperation*>(sqes[(tail - 1) & sqMask].user_data));
+        }
+        std::atomic_ref<unsigned>(*sqTail).store(tail, std::memory_order_release);
+        toSubmit = 0;
+    }
+
+    /**
+     * @brief Takes every completion
+     *
+     * @param[out] completed - requests with their results
+     */
+    void reap(std::vector<IoOperation*>& completed)
+    {
+        unsigned head = *cqHead;
+        const unsigned tail = std::atomic_ref<unsigned>(*cqTail).load(std::memory_order_acquire);
+
+        for (; head != tail; head++)
+        {
+            const io_uring_cqe& cqe = cqes[head & cqMask];
+            IoOperation* const operation = reinterpret_cast<IoOperation*>(cqe.user_data);
+            operation->mResult = cqe.res;
+            completed.push_back(operation);
+            inFlight--;
+        }
+
+        // entries may be reused by kernel
+        std::atomic_ref<unsigned>(*cqHead).store(head, std::memory_order_release);
+    }
+};
+#else
+struct AsyncIo::Ring
+{
+    unsigned entries = 0;
+    unsigned inFlight = 0;
+
+    bool setup(unsigned) { return false; }
+    bool push(IoOperation*) { return false; }
+    int submitAndWait() { return 0; }
+    int wait() { return -ENOSYS; }
+    void takeUnsubmitted(std::deque<IoOperation*>&) {}
+    void reap(std::vector<IoOperation*>&) {}
+};
+#endif
+
+IoTask::~IoTask()
+{
+    if (mHandle)
+    {
+        mHandle.destroy();
+    }
+}
+
+void IoTask::start()
+{
+    // detached task destroys itself once it finishes
+    const std::coroutine_handle<promise_type> handle = mHandle;
+    mHandle = nullptr;
+    handle.promise().detached = true;
+    handle.resume();
+}
+
+void IoOperation::await_suspend(std::coroutine_handle<> handle)
+{
+    mHandle = handle;
+    mIo.submit(this);
+}
+
+AsyncIo::AsyncIo(size_t depth, Backend backend)
+{
+    depth = std::max<size_t>(1, depth);
+
+    if (backend != Backend::ThreadPool)
+    {
+        mRing = std::make_unique<Ring>();
+        if (!mRing->setup(static_cast<unsigned>(std::min<size_t>(depth, INT_MAX))))
+        {
+            mRing.reset();
+        }
+    }
+
+    // blocking requests on thread pool without io_uring
+    if (!mRing)
+    {
+        mPool = std::make_unique<ThreadPool>(std::min<size_t>(depth, ASYNC_IO_MAX_THREADS));
+    }
+}
+
+AsyncIo::~AsyncIo() = default;
+
+IoOperation AsyncIo::open(const char* path, int flags, unsigned mode)
+{
+    IoOperation operation(*this, IoOperation::Kind::Open);
+    operation.mPath = path;
+    operation.mFlags = flags;
+    operation.mMode = mode;
+    return operation;
+}
+
+IoOperation AsyncIo::read(int fd, void* buffer, size_t length, uint64_t offset)
+{
+    IoOperation operation(*this, IoOperation::Kind::Read);
+    operation.mFd = fd;
+    operation.mBuffer = buffer;
+    operation.mLength = length;
+    operation.mOffset = offset;
+    return operation;
+}
+
+IoOperation AsyncIo::write(int fd, const void* buffer, size_t length, uint64_t offset)
+{
+    IoOperation operation(*this, IoOperation::Kind::Write);
+    operation.mFd = fd;
+    operation.mBuffer = const_cast<void*>(buffer);
+    operation.mLength = length;
+    operation.mOffset = offset;
+    return operation;
+}
+
+IoOperation AsyncIo::close(int fd)
+{
+    IoOperation operation(*this, IoOperation::Kind::Close);
+    operation.mFd = fd;
+    return operation;
+}
+
+void AsyncIo::run()
+{
+    std::vector<IoOperation*> completed;
+
+    while (mInFlight > 0)
+    {
+        completed.clear();
+        if (mRing && !mPool)
+        {
+            // requests which didn't fit into ring get freed entries
+            while (!mBacklog.empty() && mRing->push(mBacklog.front()))
+            {
+                mBacklog.pop_front();
+            }
+            if (mRing->submitAndWait() < 0)
+            {
+                // io_uring is broken, requests which kernel hasn't taken run on thread pool instead
+                this->fallBack();
+            }
+            mRing->reap(completed);
+        }
+        else if (mRing)
+        {
+            // requests taken by kernel before fall back still complete into ring
+            mRing->reap(completed);
+            while (mCompletions.try_acquire())
+            {
+                std::lock_guard<std::mutex> lock(mCompletedMutex);
+                completed.push_back(mCompleted.back());
+                mCompleted.pop_back();
+            }
+
+            // nothing has completed: wait within kernel if only ring has requests (& it still can wait),
+            // otherwise wait for thread pool a while & check ring again
+            if (completed.empty() && (mInFlight != mRing->inFlight || mRing->wait() < 0))
+            {
+                if (mCompletions.try_acquire_for(std::chrono::milliseconds(ASYNC_IO_FALLBACK_WAIT_MS)))
+                {
+                    std::lock_guard<std::mutex> lock(mCompletedMutex);
+                    completed.push_back(mCompleted.back());
+                    mCompleted.pop_back();
+                }
+            }
+        }
+        else
+        {
+            mCompletions.acquire();
+            std::lock_guard<std::mutex> lock(mCompletedMutex);
+            completed.push_back(mCompleted.back());
+            mCompleted.pop_back();
+        }
+
+        // ring without requests isn't needed after fall back
+        if (mRing && mPool && mRing->inFlight == 0)
+        {
+            mRing.reset();
+        }
+
+        // resumed coroutines submit their next requests
+        mInFlight -= completed.size();
+        for (IoOperation* operation : completed)
+        {
+            operation->mHandle.resume();
+        }
+    }
+}
+
+void AsyncIo::fallBackToPool()
+{
+    if (mRing && !mPool)
+    {
+        this->fallBack();
+    }
+}
+
+AsyncIo::Backend AsyncIo::getBackend() const
+{
+    return (mRing && !mPool) ? Backend::Ring : Backend::ThreadPool;
+}
+
+bool AsyncIo::isRingSupported()
+{
+    static const bool supported = []()
+    {
+        Ring ring;
+        return ring.setup(2);
+    }();
+    return supported;
+}
+
+IoTask AsyncIo::readFile(AsyncIo& io, std::string path, std::string& content)
+{
+    const int fd = co_await io.open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        co_return fd;
+    }
+
+    // read until EOF, buffer grows twice whenever it gets full
+    size_t size = 0;
+    int result;
+    content.resize(ASYNC_IO_READ_LEN);
+    while (true)
+    {
+        if (size == content.size())
+        {
+            content.resize(content.size() * 2);
+        }
+        result = co_await io.read(fd, content.data() + size, content.size() - size, size);
+        if (result <= 0)
+        {
+            break;
+        }
+        size += static_cast<size_t>(result);
+    }
+    content.resize(size);
+
+    co_await io.close(fd);
+    co_return std::min(result, 0);
+}
+
+IoTask AsyncIo::writeFile(AsyncIo& io, std::string path, std::string_view content)
+{
+    const int fd = co_await io.open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, ASYNC_IO_FILE_MODE);
+    if (fd < 0)
+    {
+        co_return fd;
+    }
+
+    // write may be partial
+    size_t size = 0;
+    int result = 0;
+    while (size < content.length())
+    {
+        result = co_await io.write(fd, content.data() + size, content.length() - size, size);
+        if (result < 0)
+        {
+            break;
+        }
+        size += static_cast<size_t>(result);
+        result = 0;
+    }
+
+    const int closed = co_await io.close(fd);
+    co_return (result < 0) ? result : std::min(closed, 0);
+}
+
+void AsyncIo::submit(IoOperation* operation)
+{
+    mInFlight++;
+    if (mRing && !mPool)
+    {
+        if (!mRing->push(operation))
+        {
+            mBacklog.push_back(operation);
+        }
+        return;
+    }
+    this->submitToPool(operation);
+}
+
+void AsyncIo::fallBack()
+{
+    std::deque<IoOperation*> operations;
+
+    // unsubmitted entries are older than backlog
+    mRing->takeUnsubmitted(operations);
+    operations.insert(operations.end(), mBacklog.begin(), mBacklog.end());
+    mBacklog.clear();
+
+    mPool = std::make_unique<ThreadPool>(std::min<size_t>(std::max(1u, mRing->entries), ASYNC_IO_MAX_THREADS));
+    for (IoOperation* operation : operations)
+    {
+        this->submitToPool(operation);
+    }
+}
+
+void AsyncIo::submitToPool(IoOperation* operation)
+{
+    mPool->submit([this, operation]()
+    {
+        operation->mResult = AsyncIo::execute(*operation);
+        {
+            std::lock_guard<std::mutex> lock(mCompletedMutex);
+            mCompleted.push_back(operation);
+        }
+        mCompletions.release();
+    });
+}
+
+int AsyncIo::execute(const IoOperation& operation)
+{
+    ssize_t result = 0;
+
+    switch (operation.mKind)
+    {
+    case IoOperation::Kind::Open:
+        result = ::open(operation.mPath, operation.mFlags, operation.mMode);
+        break;
+    case IoOperation::Kind::Read:
+        result = ::pread(operation.mFd, operation.mBuffer, std::min<size_t>(operation.mLength, INT_MAX), static_cast<off_t>(operation.mOffset));
+        break;
+    case IoOperation::Kind::Write:
+        result = ::pwrite(operation.mFd, operation.mBuffer, std::min<size_t>(operation.mLength, INT_MAX), static_cast<off_t>(operation.mOffset));
+        break;
+    case IoOperation::Kind::Close:
+        result = ::close(operation.mFd);
+        break;
+    }
+    return (result < 0) ? -errno : static_cast<int>(result);
+}
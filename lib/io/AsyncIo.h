@@ -0,0 +1,300 @@
+/**
+ * @file AsyncIo.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief IoTask, IoOperation & AsyncIo class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <semaphore>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "concurrency/ThreadPool.h"
+
+class AsyncIo;
+
+/**
+ * @brief Coroutine of asynchronous I/O, its result is int (i.e. 0 or negative errno).
+ *        Task starts when it is awaited (caller is resumed once task finishes) or detached with start().
+ */
+class IoTask
+{
+public:
+    struct promise_type
+    {
+        /**
+         * @brief value of co_return
+         */
+        int result = 0;
+        /**
+         * @brief coroutine which awaits task (empty if task is detached)
+         */
+        std::coroutine_handle<> continuation;
+        /**
+         * @brief detached task destroys itself once it finishes
+         */
+        bool detached = false;
+
+        /**
+         * @brief Resumes caller of finished task or destroys detached one
+         */
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+            {
+                const std::coroutine_handle<> continuation = handle.promise().continuation;
+                if (continuation)
+                {
+                    return continuation;
+                }
+                if (handle.promise().detached)
+                {
+                    handle.destroy();
+                }
+                return std::noop_coroutine();
+            }
+            void await_resume() const noexcept {}
+        };
+
+        IoTask get_return_object() { return IoTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void return_value(int value) { result = value; }
+        void unhandled_exception() const { std::terminate(); }
+    };
+
+    IoTask(IoTask&& other) noexcept : mHandle{other.mHandle} { other.mHandle = nullptr; }
+    IoTask(const IoTask&) = delete;
+    IoTask& operator=(const IoTask&) = delete;
+    /**
+     * @brief Destroy the IoTask object (& coroutine, unless it is detached)
+     */
+    ~IoTask();
+
+    /**
+     * @brief Method which starts task without awaiting it, task runs until its first I/O operation
+     *        & continues within AsyncIo::run
+     */
+    void start();
+
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept
+    {
+        mHandle.promise().continuation = caller;
+        return mHandle;
+    }
+    int await_resume() const noexcept { return mHandle.promise().result; }
+private:
+    explicit IoTask(std::coroutine_handle<promise_type> handle) : mHandle{handle} {}
+
+    std::coroutine_handle<promise_type> mHandle;
+};
+
+/**
+ * @brief Single I/O request, awaiting it submits request & suspends coroutine until it completes.
+ *        Result is the one of matching system call (i.e. number of bytes or file descriptor), or negative errno.
+ */
+class IoOperation
+{
+    friend class AsyncIo;
+public:
+    /**
+     * @brief Kind of request
+     */
+    enum class Kind
+    {
+        Open,
+        Read,
+        Write,
+        Close
+    };
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+    int await_resume() const noexcept { return mResult; }
+private:
+    IoOperation(AsyncIo& io, Kind kind) : mIo{io}, mKind{kind} {}
+
+    AsyncIo& mIo;
+    Kind mKind;
+    int mFd = -1;
+    const char* mPath = nullptr;
+    void* mBuffer = nullptr;
+    size_t mLength = 0;
+    uint64_t mOffset = 0;
+    int mFlags = 0;
+    unsigned mMode = 0;
+    int mResult = 0;
+    std::coroutine_handle<> mHandle;
+};
+
+/**
+ * @brief Event loop of asynchronous file I/O driven by coroutines.
+ *        On Linux with io_uring, requests of every suspended coroutine are queued into submission ring
+ *        & submitted with single system call, which also waits for completions, so many reads & writes
+ *        are in flight while only one thread runs coroutines. Without io_uring (old kernel, seccomp or
+ *        other OS), blocking system calls run on thread pool instead & coroutines are resumed the same way.
+ *        If io_uring fails while running, unsubmitted requests & every later one fall back to thread pool.
+ *        AsyncIo shall be used by single thread (coroutines run on thread which calls run).
+ */
+class AsyncIo
+{
+    friend class IoOperation;
+public:
+    /**
+     * @brief Implementation of requests
+     */
+    enum class Backend
+    {
+        /**
+         * @brief io_uring if kernel supports it, thread pool otherwise
+         */
+        Auto,
+        Ring,
+        ThreadPool
+    };
+
+    /**
+     * @brief Construct a new AsyncIo object
+     *
+     * @param[in] depth - expected number of requests in flight (size of ring or number of threads of pool)
+     * @param[in] backend - wanted implementation (Ring falls back to ThreadPool if io_uring is unavailable)
+     */
+    explicit AsyncIo(size_t depth, Backend backend = Backend::Auto);
+    /**
+     * @brief Destroy the AsyncIo object, every request shall be completed (see run)
+     */
+    ~AsyncIo();
+
+    AsyncIo(const AsyncIo&) = delete;
+    AsyncIo& operator=(const AsyncIo&) = delete;
+
+    /**
+     * @brief Opens file (like open system call)
+     *
+     * @param[in] path - file path, shall stay valid until request completes
+     * @param[in] flags - open flags (i.e. O_RDONLY)
+     * @param[in] mode - permissions of created file
+     * @return IoOperation - request which results in file descriptor
+     */
+    IoOperation open(const char* path, int flags, unsigned mode = 0);
+    /**
+     * @brief Reads from file at offset (like pread system call)
+     *
+     * @return IoOperation - request which results in number of read bytes (0 on EOF)
+     */
+    IoOperation read(int fd, void* buffer, size_t length, uint64_t offset);
+    /**
+     * @brief Writes into file at offset (like pwrite system call)
+     *
+     * @return IoOperation - request which results in number of written bytes
+     */
+    IoOperation write(int fd, const void* buffer, size_t length, uint64_t offset);
+    /**
+     * @brief Closes file (like close system call)
+     *
+     * @return IoOperation - request which results in 0
+     */
+    IoOperation close(int fd);
+
+    /**
+     * @brief Method which waits for completed requests & resumes their coroutines until no request is in flight
+     */
+    void run();
+
+    /**
+     * @brief Method which stops using io_uring as if it has failed: unsubmitted & later requests run on thread pool,
+     *        requests within kernel are finished by run. Intended for tests, since io_uring can't be broken on purpose.
+     */
+    void fallBackToPool();
+
+    /**
+     * @brief Get the implementation of requests
+     *
+     * @return Backend - Backend::Ring or Backend::ThreadPool (also once io_uring has failed)
+     */
+    Backend getBackend() const;
+    /**
+     * @brief Check can io_uring (with every used request) be set up within this process
+     */
+    static bool isRingSupported();
+
+    /**
+     * @brief Reads whole file into content
+     *
+     * @param[in] io - event loop
+     * @param[in] path - file to read
+     * @param[out] content - content of file
+     * @return IoTask - task which results in 0 or negative errno
+     */
+    static IoTask readFile(AsyncIo& io, std::string path, std::string& content);
+    /**
+     * @brief Writes content into file (file is created or truncated)
+     *
+     * @param[in] io - event loop
+     * @param[in] path - file to write
+     * @param[in] content - content of file, shall stay valid until task finishes
+     * @return IoTask - task which results in 0 or negative errno
+     */
+    static IoTask writeFile(AsyncIo& io, std::string path, std::string_view content);
+private:
+    struct Ring;
+
+    /**
+     * @brief io_uring (NULL if thread pool is used)
+     */
+    std::unique_ptr<Ring> mRing;
+    /**
+     * @brief requests waiting for free entry of submission ring
+     */
+    std::deque<IoOperation*> mBacklog;
+    /**
+     * @brief requests completed by thread pool
+     */
+    std::vector<IoOperation*> mCompleted;
+    std::mutex mCompletedMutex;
+    std::counting_semaphore<> mCompletions{0};
+    /**
+     * @brief thread pool of blocking requests (NULL if io_uring is used, io_uring may be finishing its requests after fall back).
+     *        It is declared behind completions, so its threads are joined before completions are destroyed.
+     */
+    std::unique_ptr<ThreadPool> mPool;
+    /**
+     * @brief number of submitted & unfinished requests
+     */
+    size_t mInFlight = 0;
+
+    /**
+     * @brief Method which submits request of suspended coroutine
+     */
+    void submit(IoOperation* operation);
+    /**
+     * @brief Method which moves unsubmitted requests of failed io_uring to thread pool (every later request goes there too)
+     */
+    void fallBack();
+    /**
+     * @brief Method which executes request on thread pool, completion is taken by run
+     */
+    void submitToPool(IoOperation* operation);
+    /**
+     * @brief Executes request with blocking system call
+     *
+     * @return int - result of system call or negative errno
+     */
+    static int execute(const IoOperation& operation);
+};
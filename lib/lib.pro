@@ -2,20 +2,70 @@ TEMPLATE = lib
 
 TARGET = AmazingAPI
 
-CONFIG += staticlib
+CONFIG += staticlib thread
 
 #Input
+HEADERS += $$PWD/bill/IBillSink.h
+HEADERS += $$PWD/bill/TextBillSink.h
+HEADERS += $$PWD/bill/CsvBillSink.h
+HEADERS += $$PWD/bill/JsonLinesBillSink.h
+HEADERS += $$PWD/bill/BinaryBill.h
+HEADERS += $$PWD/bill/BinaryBillSink.h
+HEADERS += $$PWD/bill/BinaryBillReader.h
+HEADERS += $$PWD/concurrency/BoundedQueue.h
+HEADERS += $$PWD/concurrency/ThreadPool.h
+HEADERS += $$PWD/concurrency/WorkStealingScheduler.h
 HEADERS += $$PWD/file_reader/IFileReader.h
+HEADERS += $$PWD/file_reader/NumberParser.h
+HEADERS += $$PWD/file_reader/RowErrorReport.h
+HEADERS += $$PWD/file_reader/RowException.h
+HEADERS += $$PWD/file_reader/RowSchema.h
+HEADERS += $$PWD/file_reader/BufferCsvReader.h
 HEADERS += $$PWD/file_reader/CsvReader.h
+HEADERS += $$PWD/file_reader/CsvTokenizer.h
+HEADERS += $$PWD/file_reader/MappedFile.h
+HEADERS += $$PWD/file_reader/MmapCsvReader.h
+HEADERS += $$PWD/io/AsyncIo.h
+HEADERS += $$PWD/memory/Arena.h
 HEADERS += $$PWD/objects/IObjects.h
+HEADERS += $$PWD/objects/CsvLoader.h
+HEADERS += $$PWD/objects/EanMap.h
+HEADERS += $$PWD/objects/FixedPoint.h
 HEADERS += $$PWD/objects/Items.h
 HEADERS += $$PWD/objects/Discounts.h
 HEADERS += $$PWD/objects/Orders.h
+HEADERS += $$PWD/objects/OrderBatch.h
+HEADERS += $$PWD/objects/OrderPipeline.h
+HEADERS += $$PWD/objects/PriceTable.h
+HEADERS += $$PWD/objects/PricingKernel.h
 HEADERS += $$PWD/objects/ProcessedOrders.h
+HEADERS += $$PWD/objects/Snapshot.h
+HEADERS += $$PWD/objects/StringPool.h
 
+SOURCES += $$PWD/bill/IBillSink.cc
+SOURCES += $$PWD/bill/TextBillSink.cc
+SOURCES += $$PWD/bill/CsvBillSink.cc
+SOURCES += $$PWD/bill/JsonLinesBillSink.cc
+SOURCES += $$PWD/bill/BinaryBillSink.cc
+SOURCES += $$PWD/bill/BinaryBillReader.cc
+SOURCES += $$PWD/concurrency/ThreadPool.cc
+SOURCES += $$PWD/concurrency/WorkStealingScheduler.cc
 SOURCES += $$PWD/file_reader/IFileReader.cc
+SOURCES += $$PWD/file_reader/BufferCsvReader.cc
 SOURCES += $$PWD/file_reader/CsvReader.cc
+SOURCES += $$PWD/file_reader/CsvTokenizer.cc
+SOURCES += $$PWD/file_reader/MappedFile.cc
+SOURCES += $$PWD/file_reader/MmapCsvReader.cc
+SOURCES += $$PWD/file_reader/RowErrorReport.cc
+SOURCES += $$PWD/io/AsyncIo.cc
+SOURCES += $$PWD/memory/Arena.cc
 SOURCES += $$PWD/objects/Items.cc
 SOURCES += $$PWD/objects/Discounts.cc
 SOURCES += $$PWD/objects/Orders.cc
+SOURCES += $$PWD/objects/OrderBatch.cc
+SOURCES += $$PWD/objects/OrderPipeline.cc
+SOURCES += $$PWD/objects/PriceTable.cc
+SOURCES += $$PWD/objects/PricingKernel.cc
 SOURCES += $$PWD/objects/ProcessedOrders.cc
+SOURCES += $$PWD/objects/Snapshot.cc
+SOURCES += $$PWD/objects/StringPool.cc
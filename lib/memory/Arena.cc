@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cstdint>
+
+#include "Arena.h"
+
+Arena::Arena(std::pmr::memory_resource* upstream) :
+    mUpstream{upstream}
+{
+
+}
+
+Arena::~Arena()
+{
+    this->release();
+}
+
+void Arena::reset()
+{
+    // merge blocks, so next round allocates from single one
+    if (mBlocks.size() > 1)
+    {
+        const size_t capacity = mCapacity;
+        this->release();
+        this->addBlock(capacity);
+    }
+
+    mCurrent = 0;
+    mOffset = 0;
+    mUsed = 0;
+}
+
+void Arena::release()
+{
+    for (const Block& block : mBlocks)
+    {
+        mUpstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+    }
+    mBlocks.clear();
+    mCurrent = 0;
+    mOffset = 0;
+    mCapacity = 0;
+    mUsed = 0;
+}
+
+size_t Arena::getNumOfAllocations() const
+{
+    return mNumOfAllocations;
+}
+
+size_t Arena::getNumOfUpstreamAllocations() const
+{
+    return mNumOfUpstreamAllocations;
+}
+
+size_t Arena::getCapacity() const
+{
+    return mCapacity;
+}
+
+size_t Arena::getUsed() const
+{
+    return mUsed;
+}
+
+void* Arena::do_allocate(size_t bytes, size_t alignment)
+{
+    mNumOfAllocations++;
+
+    while (true)
+    {
+        // try current block & retained blocks behind it
+        for (; mCurrent < mBlocks.size(); mCurrent++, mOffset = 0)
+        {
+            const Block& block = mBlocks[mCurrent];
+            const uintptr_t address = reinterpret_cast<uintptr_t>(block.data + mOffset);
+            const size_t padding = (alignment - address % alignment) % alignment;
+            if (padding + bytes <= block.size - mOffset)
+            {
+                void* pointer = block.data + mOffset + padding;
+                mOffset += padding + bytes;
+                mUsed += padding + bytes;
+                return pointer;
+            }
+        }
+
+        // take new block, at least double of the last one so number of blocks stays logarithmic
+        this->addBlock(std::max({static_cast<size_t>(ARENA_MIN_BLOCK_SIZE), bytes + alignment, (mBlocks.empty()) ? 0 : mBlocks.back().size * 2}));
+    }
+}
+
+void Arena::do_deallocate(void* pointer, size_t bytes, size_t alignment)
+{
+    // memory is reclaimed by reset
+    (void)pointer;
+    (void)bytes;
+    (void)alignment;
+}
+
+bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void Arena::addBlock(size_t size)
+{
+    mBlocks.push_back(Block{static_cast<std::byte*>(mUpstream->allocate(size, alignof(std::max_align_t))), size});
+    mNumOfUpstreamAllocations++;
+    mCapacity += size;
+    mCurrent = mBlocks.size() - 1;
+    mOffset = 0;
+}
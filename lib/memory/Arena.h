@@ -0,0 +1,116 @@
+/**
+ * @file Arena.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Arena class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * @brief size of the smallest block requested from upstream resource
+ */
+#define ARENA_MIN_BLOCK_SIZE (4 * 1024)
+
+/**
+ * @brief Resettable monotonic memory resource.
+ *        Allocation bumps offset within blocks taken from upstream resource, deallocation does nothing.
+ *        Reset rewinds to the first block without returning blocks upstream, so working set which fits
+ *        into blocks of previous round doesn't trip to upstream resource at all.
+ *        Not thread safe.
+ */
+class Arena : public std::pmr::memory_resource
+{
+public:
+    /**
+     * @brief Construct a new Arena object, blocks are taken on first allocation
+     *
+     * @param[in] upstream - resource of blocks
+     */
+    explicit Arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+    /**
+     * @brief Destroy the Arena object & return blocks upstream
+     */
+    ~Arena() override;
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Method which makes every block available again.
+     *        Memory allocated before is invalidated, so containers using it shall be emptied first.
+     *        Multiple blocks are merged into single one of their total size (one upstream allocation),
+     *        next round of the same working set fits into it.
+     */
+    void reset();
+    /**
+     * @brief Method which returns every block upstream
+     */
+    void release();
+
+    /**
+     * @brief Get the number of allocations served since construction
+     */
+    size_t getNumOfAllocations() const;
+    /**
+     * @brief Get the number of blocks requested from upstream resource since construction
+     */
+    size_t getNumOfUpstreamAllocations() const;
+    /**
+     * @brief Get the total size of blocks in bytes
+     */
+    size_t getCapacity() const;
+    /**
+     * @brief Get the number of bytes allocated since last reset (including alignment padding)
+     */
+    size_t getUsed() const;
+private:
+    /**
+     * @brief Memory taken from upstream resource
+     */
+    struct Block
+    {
+        std::byte* data;
+        size_t size;
+    };
+
+    /**
+     * @brief resource of blocks
+     */
+    std::pmr::memory_resource* mUpstream;
+    /**
+     * @brief blocks in order of usage
+     */
+    std::vector<Block> mBlocks;
+    /**
+     * @brief index of block which serves allocations
+     */
+    size_t mCurrent = 0;
+    /**
+     * @brief offset of free memory within current block
+     */
+    size_t mOffset = 0;
+    size_t mNumOfAllocations = 0;
+    size_t mNumOfUpstreamAllocations = 0;
+    size_t mCapacity = 0;
+    size_t mUsed = 0;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    /**
+     * @brief Method which takes block from upstream resource & makes it current one
+     *
+     * @param[in] size - block size in bytes
+     */
+    void addBlock(size_t size);
+};
@@ -0,0 +1,224 @@
+/**
+ * @file CsvLoader.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Sequential & parallel row loading of shop objects
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/ThreadPool.h"
+#include "concurrency/WorkStealingScheduler.h"
+#include "file_reader/IFileReader.h"
+#include "file_reader/MappedFile.h"
+#include "file_reader/MmapCsvReader.h"
+#include "file_reader/RowErrorReport.h"
+#include "file_reader/RowException.h"
+
+#define ROW_BATCH_LEN 1024
+#define PARALLEL_CHUNK_MIN_LEN (64 * 1024)
+#define PARALLEL_CHUNKS_PER_THREAD 4
+
+/**
+ * @brief Splits mapped file into chunks, every chunk (except the last one) ends behind newline
+ *
+ * @param[in] file - mapped file
+ * @param[in] numOfChunks - wanted number of chunks (chunk is at least PARALLEL_CHUNK_MIN_LEN long)
+ * @return std::vector<std::pair<size_t, size_t>> - begin & end offset of every chunk
+ */
+inline std::vector<std::pair<size_t, size_t>> splitRows(const MappedFile& file, size_t numOfChunks)
+{
+    std::vector<std::pair<size_t, size_t>> chunks;
+
+    const size_t chunkLength = std::max<size_t>(PARALLEL_CHUNK_MIN_LEN, file.size() / std::max<size_t>(1, numOfChunks) + 1);
+    for (size_t begin = 0; begin < file.size();)
+    {
+        size_t end = begin + chunkLength;
+        if (end >= file.size())
+        {
+            end = file.size();
+        }
+        else
+        {
+            const void* newline = std::memchr(file.data() + end, '\n', file.size() - end);
+            end = (newline) ? static_cast<size_t>(static_cast<const char*>(newline) - file.data()) + 1 : file.size();
+        }
+        chunks.emplace_back(begin, end);
+        begin = end;
+    }
+    return chunks;
+}
+
+/**
+ * @brief Outcome of parsed chunk of rows
+ */
+template <typename Collection>
+struct ParsedChunk
+{
+    Collection collection;
+    RowErrorReport report;
+    size_t rows = 0;
+    std::exception_ptr error;
+};
+
+/**
+ * @brief Parses rows of chunk, failure is kept within chunk
+ */
+template <typename Collection, typename ParseRows>
+void parseChunk(const std::shared_ptr<const MappedFile>& file, std::pair<size_t, size_t> range, size_t budget, ParseRows& parseRows, ParsedChunk<Collection>& chunk)
+{
+    MmapCsvReader chunkReader;
+    chunkReader.openRange(file, range.first, range.second);
+    chunk.report.setBudget(budget);
+    try
+    {
+        parseRows(chunkReader, chunk.collection, chunk.report);
+    }
+    catch (...)
+    {
+        chunk.error = std::current_exception();
+    }
+    chunk.rows = chunkReader.getRowNum();
+}
+
+/**
+ * @brief Collects parsed chunks in file order: skipped rows & the first failed row are reported,
+ *        then partial collections are merged from the last one, keys merged before come from later rows
+ *
+ * @exception RowException on first (in file order) failed row beyond error budget, with row number within whole file
+ *
+ * @return size_t - number of rows within file
+ */
+template <typename Collection, typename Merge>
+size_t mergeChunks(std::vector<ParsedChunk<Collection>>& chunks, Collection& collection, RowErrorReport& report, Merge merge) noexcept(false)
+{
+    size_t firstRow = 0;
+    for (ParsedChunk<Collection>& chunk : chunks)
+    {
+        report.add(chunk.report.getErrors(), firstRow);
+        if (chunk.error)
+        {
+            try
+            {
+                std::rethrow_exception(chunk.error);
+            }
+            catch (const RowException& e)
+            {
+                // renumber row from chunk to whole file
+                throw RowException(firstRow + e.getRow(), e.getReason());
+            }
+        }
+        firstRow += chunk.rows;
+    }
+
+    for (auto it = chunks.rbegin(); it != chunks.rend(); it++)
+    {
+        merge(collection, it->collection);
+    }
+    return firstRow;
+}
+
+/**
+ * @brief Loads every row of file into collection on multiple threads.
+ *        File is mapped & split into chunks at newline boundaries, chunks are parsed on thread pool
+ *        into partial collections which are merged so later rows override earlier ones
+ *        the same way as sequential loading does.
+ *
+ * @exception RowException on first (in file order) failed row beyond error budget, with row number within whole file
+ * @exception std::runtime_error if open file has failed
+ *
+ * @param[in] filename - CSV file to load
+ * @param[in] numThreads - number of threads (0 means hardware concurrency)
+ * @param[out] collection - empty collection to fill, merge(Collection&) of it shall keep existing keys (like std::map::merge)
+ * @param[in, out] report - report of skipped rows (with error budget), rows are numbered within whole file
+ * @param[in] parseRows - function which parses every row of reader into collection & report
+ */
+template <typename Collection, typename ParseRows>
+void loadRowsParallel(const std::string& filename, size_t numThreads, Collection& collection, RowErrorReport& report, ParseRows parseRows) noexcept(false)
+{
+    MmapCsvReader reader;
+    reader.open(filename);
+
+    const std::shared_ptr<const MappedFile> file = reader.getMappedFile();
+    ThreadPool pool(numThreads);
+
+    // parse chunks on thread pool
+    std::vector<std::future<ParsedChunk<Collection>>> futures;
+    const size_t budget = report.getBudget();
+    for (const std::pair<size_t, size_t>& range : splitRows(*file, pool.getNumOfThreads() * PARALLEL_CHUNKS_PER_THREAD))
+    {
+        futures.push_back(pool.submit([file, range, budget, parseRows]() mutable
+        {
+            ParsedChunk<Collection> chunk;
+            parseChunk(file, range, budget, parseRows, chunk);
+            return chunk;
+        }));
+    }
+
+    // wait for every chunk, keys of later rows win
+    std::vector<ParsedChunk<Collection>> chunks;
+    chunks.reserve(futures.size());
+    for (std::future<ParsedChunk<Collection>>& future : futures)
+    {
+        chunks.push_back(future.get());
+    }
+    mergeChunks(chunks, collection, report, [](Collection& into, Collection& from) { into.merge(from); });
+}
+
+/**
+ * @brief Loads every row of file into collection with tasks of work stealing scheduler.
+ *        Chunks of file are subtasks of calling task, so idle workers steal chunks of big file
+ *        while its owner parses the rest. Result is the same as sequential loading.
+ *
+ * @exception RowException on first (in file order) failed row beyond error budget, with row number within whole file
+ * @exception std::runtime_error if open file has failed
+ *
+ * @param[in] filename - CSV file to load
+ * @param[in] scheduler - scheduler of chunks
+ * @param[out] collection - empty collection to fill
+ * @param[in, out] report - report of skipped rows (with error budget), rows are numbered within whole file
+ * @param[in] parseRows - function which parses every row of reader into collection & report
+ * @param[in] merge - function which merges partial collection of earlier rows (second argument) into collection (first argument)
+ * @return size_t - number of rows within file
+ */
+template <typename Collection, typename ParseRows, typename Merge>
+size_t loadRowsStealing(const std::string& filename, WorkStealingScheduler& scheduler, Collection& collection, RowErrorReport& report, ParseRows parseRows, Merge merge) noexcept(false)
+{
+    MmapCsvReader reader;
+    reader.open(filename);
+
+    const std::shared_ptr<const MappedFile> file = reader.getMappedFile();
+    const std::vector<std::pair<size_t, size_t>> ranges = splitRows(*file, scheduler.getNumOfThreads() * PARALLEL_CHUNKS_PER_THREAD);
+    std::vector<ParsedChunk<Collection>> chunks(ranges.size());
+    const size_t budget = report.getBudget();
+
+    // single chunk is parsed by calling thread
+    if (ranges.size() == 1)
+    {
+        parseChunk(file, ranges[0], budget, parseRows, chunks[0]);
+        return mergeChunks(chunks, collection, report, merge);
+    }
+
+    TaskGroup group;
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        scheduler.submit(group, [&file, &ranges, &chunks, &parseRows, budget, i]()
+        {
+            parseChunk(file, ranges[i], budget, parseRows, chunks[i]);
+        });
+    }
+    scheduler.wait(group);
+    return mergeChunks(chunks, collection, report, merge);
+}
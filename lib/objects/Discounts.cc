@@ -1,9 +1,27 @@
 #include <iostream>
+#include <algorithm>
+#include <vector>
 
 #include "Discounts.h"
+#include "CsvLoader.h"
+#include "file_reader/RowSchema.h"
 
-#define DISCOUNTS_NUM_OF_COLS 2
-#define EAN13_LEN 13
+/**
+ * @brief Discount CSV row layout
+ */
+using DiscountsSchema = RowSchema<Ean13Column, FixedPointColumn<Percent>>;
+
+/**
+ * @brief Discount record within snapshot
+ */
+struct DiscountRecord
+{
+    uint64_t ean13;
+    Discount discount;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(DiscountRecord) == 16, "Discount record shall keep its layout");
 
 bool Discount::operator==(const Discount& other) const
 {
@@ -12,41 +30,101 @@ bool Discount::operator==(const Discount& other) const
 
 void Discounts::operator<<(std::shared_ptr<IFileReader> reader) noexcept(false)
 {
-    Discount* item;
-    uint64_t key;
+    // clear map
+    mDiscounts.clear();
+    mSnapshot.close();
+    mErrorReport.clear();
+    this->nextGeneration();
 
+    // batch reading loop
+    parseRows(*reader, mDiscounts, mErrorReport);
+}
+
+void Discounts::loadParallel(const std::string& filename, size_t numThreads) noexcept(false)
+{
     // clear map
     mDiscounts.clear();
+    mSnapshot.close();
+    mErrorReport.clear();
+    this->nextGeneration();
 
-    // pass expected number of columns
-    reader->setNumOfCols(DISCOUNTS_NUM_OF_COLS);
+    // parse chunks of file on multiple threads
+    loadRowsParallel(filename, numThreads, mDiscounts, mErrorReport, &Discounts::parseRows);
+}
 
-    // lambda expression
-    auto validateEan13 = [](const std::string& to_validate, std::string& error)
+const char* Discounts::getObjectType() const
+{
+    return "Discounts";
+}
+
+bool Discounts::loadSnapshot(const std::string& csvFilename)
+{
+    mDiscounts.clear();
+    mErrorReport.clear();
+    this->nextGeneration();
+    return mSnapshot.open(csvFilename, SnapshotType::Discounts, sizeof(DiscountRecord), mErrorReport.getBudget());
+}
+
+void Discounts::saveSnapshot(const std::string& csvFilename) const noexcept(false)
+{
+    std::vector<DiscountRecord> records;
+
+    // mapped snapshot is up to date already
+    if (mSnapshot.isOpen())
     {
-        if (to_validate.length() != EAN13_LEN)
-        {
-            error = "EAN13 shall be 13 digits long.";
-            return false;
-        }
-        return true;
-    };
+        return;
+    }
 
-    // row reading loop
-    while (reader->read())
+    // records are sorted by EAN 13 for binary search
+    records.reserve(mDiscounts.size());
+    for (const auto& element : mDiscounts)
     {
-        // read EAN-13
-        key = reader->extractULongLong(validateEan13);
+        records.push_back(DiscountRecord{element.first, element.second, 0});
+    }
+    std::sort(records.begin(), records.end(), [](const DiscountRecord& a, const DiscountRecord& b)
+    {
+        return a.ean13 < b.ean13;
+    });
 
-        // insert map element with EAN-13 key
-        item = &mDiscounts.insert(std::make_pair(key, Discount())).first->second;
+    Snapshot::write(csvFilename, SnapshotType::Discounts, records.data(), sizeof(DiscountRecord), records.size(), std::string_view(),
+                    mErrorReport.getErrors().size());
+}
 
-        // read discount percentage
-        item->discountPercent = reader->extractFloat();
+const Discount* Discounts::getDiscount(uint64_t key) const
+{
+    if (mSnapshot.isOpen())
+    {
+        // binary search within mapped records, discount is used in place
+        const DiscountRecord* begin = static_cast<const DiscountRecord*>(mSnapshot.getRecords());
+        const DiscountRecord* end = begin + mSnapshot.getNumOfRecords();
+        const DiscountRecord* record = std::lower_bound(begin, end, key, [](const DiscountRecord& record, uint64_t key)
+        {
+            return record.ean13 < key;
+        });
+        return (record != end && record->ean13 == key) ? &record->discount : nullptr;
     }
+
+    return mDiscounts.find(key);
 }
 
-const char* Discounts::getObjectType() const
+void Discounts::parseRows(IFileReader& reader, EanMap<Discount>& discounts, RowErrorReport& report) noexcept(false)
 {
-    return "Discounts";
+    std::vector<uint64_t> keys(ROW_BATCH_LEN);
+    std::vector<Percent> discountPercents(ROW_BATCH_LEN);
+    std::vector<RowError> errors;
+    size_t decoded;
+
+    do
+    {
+        // decode batch of rows into columns, malformed rows are recorded (or rejected by error budget)
+        errors.clear();
+        decoded = reader.readBatch<DiscountsSchema>(errors, keys, discountPercents);
+        report.add(errors);
+
+        // insert hash map elements with EAN-13 keys (or overwrite existing ones)
+        for (size_t i = 0; i < decoded; i++)
+        {
+            discounts[keys[i]].discountPercent = discountPercents[i];
+        }
+    } while (decoded == ROW_BATCH_LEN);
 }
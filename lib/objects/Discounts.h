@@ -11,10 +11,12 @@
 
 #pragma once
 
-#include <map>
 #include <cstdint>
 
+#include "EanMap.h"
+#include "FixedPoint.h"
 #include "IObjects.h"
+#include "Snapshot.h"
 #include "file_reader/CsvReader.h"
 
 class ProcessedOrders;
@@ -27,7 +29,7 @@ struct Discount
     /**
      * @brief discount percent
      */
-    float discountPercent;
+    Percent discountPercent;
 
     /**
      * @brief Overloaded perator.
@@ -72,9 +74,58 @@ public:
      * @return name in string format
      */
     const char* getObjectType() const override;
+    /**
+     * @brief Method which handles parallel deserialization of discount objects from CSV file
+     *
+     * @exception RowException reading error with row number
+     * @exception std::runtime_error open file error
+     *
+     * @param[in] filename - CSV file
+     * @param[in] numThreads - number of threads (0 means hardware concurrency)
+     */
+    void loadParallel(const std::string& filename, size_t numThreads) noexcept(false) override;
+    /**
+     * @brief Method which maps snapshot of discount objects instead of CSV deserialization
+     *
+     * @param[in] csvFilename - CSV file which snapshot belongs to
+     * @return true - discount objects are taken from snapshot
+     * @return false - snapshot is missing, stale, corrupted or it skipped more rows than error budget allows (discount objects are cleared)
+     */
+    bool loadSnapshot(const std::string& csvFilename) override;
+    /**
+     * @brief Method which writes snapshot of discount objects deserialized from CSV file
+     *
+     * @exception std::runtime_error if writing has failed
+     *
+     * @param[in] csvFilename - CSV file which discount objects are deserialized from
+     */
+    void saveSnapshot(const std::string& csvFilename) const noexcept(false) override;
+
+    /**
+     * @brief Get the Discount object from map (or from snapshot)
+     *
+     * @param[in] key - EAN 13 ID
+     * @return const Discount* - pointer to discount object if found it or NULL if not
+     */
+    const Discount* getDiscount(uint64_t key) const;
 private:
     /**
-     * @brief Map of Discount objects
+     * @brief Hash map of Discount objects
+     */
+    EanMap<Discount> mDiscounts;
+    /**
+     * @brief mapped snapshot (discount objects are used in place)
+     */
+    Snapshot mSnapshot;
+
+    /**
+     * @brief Method which parses every row of reader into map of Discount objects (in batches)
+     *
+     * @exception RowException reading error with row number (beyond error budget)
+     *
+     * @param[in] reader - opened file reading handler
+     * @param[out] discounts - hash map to insert Discount object into
+     * @param[in, out] report - report of skipped rows
      */
-    std::map<uint64_t, Discount> mDiscounts;
+    static void parseRows(IFileReader& reader, EanMap<Discount>& discounts, RowErrorReport& report) noexcept(false);
 };
@@ -0,0 +1,333 @@
+/**
+ * @file EanMap.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Open addressing hash map of EAN 13 keys (EanMap class definition)
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief key of free slot, EAN 13 IDs never exceed 13 digits
+ */
+#define EAN_MAP_EMPTY_KEY UINT64_MAX
+#define EAN_MAP_MIN_CAPACITY 16
+/**
+ * @brief maximal load factor of slots (3/4)
+ */
+#define EAN_MAP_MAX_LOAD_NUM 3
+#define EAN_MAP_MAX_LOAD_DEN 4
+/**
+ * @brief 2^64 / golden ratio, multiplication spreads consecutive EANs across the whole table
+ */
+#define EAN_MAP_HASH_MULTIPLIER 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief Hash map of EAN 13 keys with linear probing.
+ *        Keys & values live in two flat arrays of slots (same index), so lookup scans few neighbouring keys
+ *        instead of chasing tree nodes across the heap. Capacity is power of 2, slot of key is taken from
+ *        the top bits of Fibonacci hash. Pointers to values are invalidated by insertion of new key.
+ *        Iteration order is unspecified. Slots are allocated from memory resource (i.e. Arena of per order data).
+ *
+ * @tparam Value - default constructible value type
+ */
+template <typename Value>
+class EanMap
+{
+public:
+    /**
+     * @brief Forward iterator over occupied slots, dereferences into pair of key & reference to value
+     */
+    template <typename MapValue>
+    class Iterator
+    {
+    public:
+        Iterator(const uint64_t* keys, MapValue* values, size_t slot, size_t capacity) :
+            mKeys{keys}, mValues{values}, mSlot{slot}, mCapacity{capacity}
+        {
+            skipFreeSlots();
+        }
+
+        std::pair<uint64_t, MapValue&> operator*() const { return {mKeys[mSlot], mValues[mSlot]}; }
+        Iterator& operator++() { mSlot++; skipFreeSlots(); return *this; }
+        bool operator==(const Iterator& other) const { return mSlot == other.mSlot; }
+        bool operator!=(const Iterator& other) const { return mSlot != other.mSlot; }
+    private:
+        const uint64_t* mKeys;
+        MapValue* mValues;
+        size_t mSlot;
+        size_t mCapacity;
+
+        void skipFreeSlots()
+        {
+            while (mSlot < mCapacity && mKeys[mSlot] == EAN_MAP_EMPTY_KEY)
+            {
+                mSlot++;
+            }
+        }
+    };
+
+    /**
+     * @brief Construct a new EanMap object
+     *
+     * @param[in] resource - memory resource of slots
+     */
+    explicit EanMap(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+        mKeys{resource}, mValues{resource}
+    {
+
+    }
+
+    /**
+     * @brief Get the value of key, default constructed value is inserted if key is missing
+     *
+     * @exception std::invalid_argument if key is EAN_MAP_EMPTY_KEY
+     *
+     * @param[in] key - EAN 13 ID
+     * @return Value& - value of key
+     */
+    Value& operator[](uint64_t key) noexcept(false)
+    {
+        if (key == EAN_MAP_EMPTY_KEY)
+        {
+            throw std::invalid_argument("EanMap can't hold key " + std::to_string(key));
+        }
+
+        // grow before insertion, so probing always finds free slot
+        if ((mSize + 1) * EAN_MAP_MAX_LOAD_DEN > mKeys.size() * EAN_MAP_MAX_LOAD_NUM)
+        {
+            rehash(std::max<size_t>(EAN_MAP_MIN_CAPACITY, mKeys.size() * 2));
+        }
+
+        const size_t slot = locate(key);
+        if (mKeys[slot] == EAN_MAP_EMPTY_KEY)
+        {
+            mKeys[slot] = key;
+            mSize++;
+        }
+        return mValues[slot];
+    }
+
+    /**
+     * @brief Find the value of key
+     *
+     * @param[in] key - EAN 13 ID
+     * @return const Value* - value of key or NULL if key is missing
+     */
+    const Value* find(uint64_t key) const
+    {
+        if (mSize == 0)
+        {
+            return nullptr;
+        }
+
+        // free slot ends the chain of probed keys
+        for (size_t slot = slotOf(key); ; slot = (slot + 1) & mMask)
+        {
+            const uint64_t slotKey = mKeys[slot];
+            if (slotKey == EAN_MAP_EMPTY_KEY)
+            {
+                return nullptr;
+            }
+            if (slotKey == key)
+            {
+                return &mValues[slot];
+            }
+        }
+    }
+    /**
+     * @brief Find the value of key
+     */
+    Value* find(uint64_t key)
+    {
+        return const_cast<Value*>(static_cast<const EanMap*>(this)->find(key));
+    }
+
+    /**
+     * @brief Method which prepares slots for number of keys (no rehash happens until then)
+     *
+     * @param[in] numOfKeys - expected number of keys
+     */
+    void reserve(size_t numOfKeys)
+    {
+        size_t capacity = EAN_MAP_MIN_CAPACITY;
+        while (numOfKeys * EAN_MAP_MAX_LOAD_DEN > capacity * EAN_MAP_MAX_LOAD_NUM)
+        {
+            capacity *= 2;
+        }
+        if (capacity > mKeys.size())
+        {
+            rehash(capacity);
+        }
+    }
+    /**
+     * @brief Method which takes over values of other map whose keys are missing within this one (like std::map::merge),
+     *        other map is left empty
+     *
+     * @param[in, out] other - map to merge
+     */
+    void merge(EanMap& other)
+    {
+        reserve(mSize + other.mSize);
+        for (size_t i = 0; i < other.mKeys.size(); i++)
+        {
+            if (other.mKeys[i] == EAN_MAP_EMPTY_KEY)
+            {
+                continue;
+            }
+
+            const size_t slot = locate(other.mKeys[i]);
+            if (mKeys[slot] == EAN_MAP_EMPTY_KEY)
+            {
+                mKeys[slot] = other.mKeys[i];
+                mValues[slot] = std::move(other.mValues[i]);
+                mSize++;
+            }
+        }
+        other.clear();
+    }
+    /**
+     * @brief Method which takes over every value of other map, values of keys existing within both maps are combined.
+     *        Other map is left empty.
+     *
+     * @param[in, out] other - map to merge
+     * @param[in] combine - function which combines value of this map (first argument) with value of other map (second argument)
+     */
+    template <typename Combine>
+    void merge(EanMap& other, Combine combine)
+    {
+        reserve(mSize + other.mSize);
+        for (size_t i = 0; i < other.mKeys.size(); i++)
+        {
+            if (other.mKeys[i] == EAN_MAP_EMPTY_KEY)
+            {
+                continue;
+            }
+
+            const size_t slot = locate(other.mKeys[i]);
+            if (mKeys[slot] == EAN_MAP_EMPTY_KEY)
+            {
+                mKeys[slot] = other.mKeys[i];
+                mValues[slot] = std::move(other.mValues[i]);
+                mSize++;
+            }
+            else
+            {
+                combine(mValues[slot], other.mValues[i]);
+            }
+        }
+        other.clear();
+    }
+    /**
+     * @brief Method which removes every key & releases slots
+     */
+    void clear()
+    {
+        std::pmr::vector<uint64_t>(mKeys.get_allocator()).swap(mKeys);
+        std::pmr::vector<Value>(mValues.get_allocator()).swap(mValues);
+        mSize = 0;
+        mMask = 0;
+        mShift = 0;
+    }
+
+    /**
+     * @brief Get the number of keys
+     */
+    size_t size() const { return mSize; }
+    /**
+     * @brief Check is map without keys
+     */
+    bool empty() const { return mSize == 0; }
+    /**
+     * @brief Get the memory resource of slots
+     */
+    std::pmr::memory_resource* getResource() const { return mKeys.get_allocator().resource(); }
+
+    Iterator<Value> begin() { return Iterator<Value>(mKeys.data(), mValues.data(), 0, mKeys.size()); }
+    Iterator<Value> end() { return Iterator<Value>(mKeys.data(), mValues.data(), mKeys.size(), mKeys.size()); }
+    Iterator<const Value> begin() const { return Iterator<const Value>(mKeys.data(), mValues.data(), 0, mKeys.size()); }
+    Iterator<const Value> end() const { return Iterator<const Value>(mKeys.data(), mValues.data(), mKeys.size(), mKeys.size()); }
+private:
+    /**
+     * @brief keys of slots (EAN_MAP_EMPTY_KEY within free slot)
+     */
+    std::pmr::vector<uint64_t> mKeys;
+    /**
+     * @brief values of slots
+     */
+    std::pmr::vector<Value> mValues;
+    /**
+     * @brief number of keys
+     */
+    size_t mSize = 0;
+    /**
+     * @brief capacity - 1
+     */
+    size_t mMask = 0;
+    /**
+     * @brief 64 - log2(capacity)
+     */
+    unsigned mShift = 0;
+
+    /**
+     * @brief Get the home slot of key
+     */
+    size_t slotOf(uint64_t key) const
+    {
+        return static_cast<size_t>((key * EAN_MAP_HASH_MULTIPLIER) >> mShift);
+    }
+    /**
+     * @brief Get the slot which holds key or free slot which shall hold it
+     */
+    size_t locate(uint64_t key) const
+    {
+        size_t slot = slotOf(key);
+        while (mKeys[slot] != EAN_MAP_EMPTY_KEY && mKeys[slot] != key)
+        {
+            slot = (slot + 1) & mMask;
+        }
+        return slot;
+    }
+    /**
+     * @brief Method which moves every key into new slots
+     *
+     * @param[in] capacity - number of new slots (power of 2)
+     */
+    void rehash(size_t capacity)
+    {
+        std::pmr::vector<uint64_t> keys(capacity, EAN_MAP_EMPTY_KEY, mKeys.get_allocator());
+        std::pmr::vector<Value> values(capacity, mValues.get_allocator());
+
+        keys.swap(mKeys);
+        values.swap(mValues);
+        mMask = capacity - 1;
+        mShift = 64;
+        for (size_t i = capacity; i > 1; i /= 2)
+        {
+            mShift--;
+        }
+
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            if (keys[i] != EAN_MAP_EMPTY_KEY)
+            {
+                const size_t slot = locate(keys[i]);
+                mKeys[slot] = keys[i];
+                mValues[slot] = std::move(values[i]);
+            }
+        }
+    }
+};
@@ -0,0 +1,318 @@
+/**
+ * @file FixedPoint.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Exact fixed point Money, Percent & Quantity types (FixedPoint class definition)
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "file_reader/NumberParser.h"
+
+/**
+ * @brief number of fraction digits of Money (minor unit is 0.01)
+ */
+#define MONEY_DIGITS 2
+/**
+ * @brief number of fraction digits of Percent (minor unit is 0.01 %)
+ */
+#define PERCENT_DIGITS 2
+/**
+ * @brief number of fraction digits of Quantity (minor unit is 0.001)
+ */
+#define QUANTITY_DIGITS 3
+/**
+ * @brief the longest formatted fixed point number (sign, 19 integer digits, point & 3 fraction digits)
+ */
+#define FIXED_POINT_MAX_LEN 24
+
+/**
+ * @brief Get the power of 10
+ *
+ * @param[in] exponent - non-negative exponent
+ * @return int64_t - 10^exponent
+ */
+constexpr int64_t powerOf10(int exponent)
+{
+    int64_t power = 1;
+    for (int i = 0; i < exponent; i++)
+    {
+        power *= 10;
+    }
+    return power;
+}
+
+/**
+ * @brief Divides integers & rounds quotient half away from zero.
+ *        This is the only rounding rule of prices.
+ *
+ * @tparam T - signed integer type
+ * @param[in] numerator - dividend
+ * @param[in] denominator - positive divisor
+ * @return T - rounded quotient
+ */
+template <typename T>
+constexpr T divideRounded(T numerator, T denominator)
+{
+    return (numerator >= 0) ? (numerator + denominator / 2) / denominator : -((-numerator + denominator / 2) / denominator);
+}
+
+/**
+ * @brief Multiplies integers & divides their 128-bit product, quotient is rounded half away from zero
+ *        (the same way as divideRounded). Product is never truncated, so quotient is exact whenever it fits into int64_t.
+ *        Uses 64x64 -> 128 bit multiplication & 128 / 64 bit division (intrinsics on MSVC, which lacks __int128).
+ *
+ * @exception std::overflow_error if quotient doesn't fit into int64_t
+ *
+ * @param[in] multiplicand - first factor
+ * @param[in] multiplier - second factor
+ * @param[in] denominator - positive divisor
+ * @return int64_t - rounded quotient
+ */
+inline int64_t multiplyDivideRounded(int64_t multiplicand, int64_t multiplier, int64_t denominator) noexcept(false)
+{
+    const bool negative = (multiplicand < 0) != (multiplier < 0);
+    const uint64_t a = (multiplicand < 0) ? 0 - static_cast<uint64_t>(multiplicand) : static_cast<uint64_t>(multiplicand);
+    const uint64_t b = (multiplier < 0) ? 0 - static_cast<uint64_t>(multiplier) : static_cast<uint64_t>(multiplier);
+    const uint64_t divisor = static_cast<uint64_t>(denominator);
+    uint64_t high;
+    uint64_t low;
+    uint64_t quotient;
+    uint64_t remainder;
+
+    // magnitude of product
+#ifdef _MSC_VER
+    low = _umul128(a, b, &high);
+#else
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    high = static_cast<uint64_t>(product >> 64);
+    low = static_cast<uint64_t>(product);
+#endif
+
+    // quotient of 128 / 64 bit division fits into 64 bits only if upper half is less than divisor
+    if (high >= divisor)
+    {
+        throw std::overflow_error("Product of fixed point numbers doesn't fit into 64 bits.");
+    }
+#ifdef _MSC_VER
+    quotient = _udiv128(high, low, divisor, &remainder);
+#else
+    const unsigned __int128 dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+    quotient = static_cast<uint64_t>(dividend / divisor);
+    remainder = static_cast<uint64_t>(dividend % divisor);
+#endif
+
+    // round half away from zero & apply sign
+    if (remainder >= divisor - remainder)
+    {
+        quotient++;
+    }
+    if (quotient > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + (negative ? 1 : 0))
+    {
+        throw std::overflow_error("Product of fixed point numbers doesn't fit into 64 bits.");
+    }
+    return static_cast<int64_t>(negative ? 0 - quotient : quotient);
+}
+
+/**
+ * @brief Decimal number stored as integer count of minor units (i.e. Money of 1.21 holds 121).
+ *        Sums are exact & don't depend on order of summation.
+ *
+ * @tparam Tag - distinguishes quantities of the same precision (i.e. Money & Percent)
+ * @tparam Storage - signed integer type of minor units
+ * @tparam Digits - number of fraction digits
+ */
+template <typename Tag, typename Storage, int Digits>
+class FixedPoint
+{
+public:
+    /**
+     * @brief number of fraction digits
+     */
+    static constexpr int NumOfDigits = Digits;
+    /**
+     * @brief number of minor units within 1
+     */
+    static constexpr int64_t Scale = powerOf10(Digits);
+    /**
+     * @brief the biggest value in minor units
+     */
+    static constexpr int64_t MaxMinorUnits = std::numeric_limits<Storage>::max();
+
+    /**
+     * @brief Construct zero
+     */
+    constexpr FixedPoint() = default;
+
+    /**
+     * @brief Construct a new FixedPoint object from minor units
+     *
+     * @param[in] minorUnits - value multiplied by Scale
+     * @return FixedPoint - fixed point number
+     */
+    static constexpr FixedPoint fromMinorUnits(int64_t minorUnits)
+    {
+        FixedPoint number;
+        number.mMinorUnits = static_cast<Storage>(minorUnits);
+        return number;
+    }
+    /**
+     * @brief Construct a new FixedPoint object from decimal text (same format as CSV cells)
+     *
+     * @exception std::runtime_error, std::invalid_argument, std::out_of_range if text isn't valid decimal number
+     *
+     * @param[in] text - positive decimal number, fraction digits beyond precision are rounded
+     * @return FixedPoint - fixed point number
+     */
+    static FixedPoint parse(std::string_view text) noexcept(false)
+    {
+        int64_t minorUnits;
+        ParseStatus status = parseFixedPoint(text, Digits, minorUnits);
+        if (status == ParseStatus::Ok && minorUnits > MaxMinorUnits)
+        {
+            status = ParseStatus::OutOfRange;
+        }
+        throwOnParseFailure(status, text, "decimal number", "fixed point");
+        return fromMinorUnits(minorUnits);
+    }
+
+    /**
+     * @brief Get the minor units
+     *
+     * @return int64_t - value multiplied by Scale
+     */
+    constexpr int64_t getMinorUnits() const { return mMinorUnits; }
+    /**
+     * @brief Converts value into double (for reporting only, prices are calculated with minor units)
+     */
+    double toDouble() const { return static_cast<double>(mMinorUnits) / Scale; }
+    /**
+     * @brief Formats value with fixed number of fraction digits (rounded half away from zero)
+     *
+     * @param[in] digits - number of fraction digits, not bigger than Digits
+     * @return std::string - i.e. "14.97"
+     */
+    std::string toString(int digits = Digits) const
+    {
+        char text[FIXED_POINT_MAX_LEN];
+        return std::string(text, toChars(text, digits));
+    }
+    /**
+     * @brief Formats value like toString, but into external buffer (without allocation)
+     *
+     * @param[out] first - buffer of at least FIXED_POINT_MAX_LEN characters
+     * @param[in] digits - number of fraction digits, not bigger than Digits
+     * @return char* - end of formatted value
+     */
+    char* toChars(char* first, int digits = Digits) const
+    {
+        const int64_t scale = powerOf10(digits);
+        const int64_t rounded = divideRounded<int64_t>(mMinorUnits, powerOf10(Digits - digits));
+        const uint64_t absolute = (rounded < 0) ? 0 - static_cast<uint64_t>(rounded) : static_cast<uint64_t>(rounded);
+
+        if (rounded < 0)
+        {
+            *first++ = '-';
+        }
+        first = std::to_chars(first, first + FIXED_POINT_MAX_LEN, absolute / scale).ptr;
+        if (digits > 0)
+        {
+            // fraction digits are zero padded from the right end
+            uint64_t fraction = absolute % scale;
+            *first = '.';
+            for (int i = digits; i > 0; i--)
+            {
+                first[i] = static_cast<char>('0' + fraction % 10);
+                fraction /= 10;
+            }
+            first += digits + 1;
+        }
+        return first;
+    }
+
+    constexpr FixedPoint operator+(FixedPoint other) const { return fromMinorUnits(mMinorUnits + other.mMinorUnits); }
+    constexpr FixedPoint operator-(FixedPoint other) const { return fromMinorUnits(mMinorUnits - other.mMinorUnits); }
+    constexpr FixedPoint& operator+=(FixedPoint other) { mMinorUnits += other.mMinorUnits; return *this; }
+    constexpr bool operator==(const FixedPoint& other) const = default;
+    constexpr auto operator<=>(const FixedPoint& other) const = default;
+
+    /**
+     * @brief Prints value with every fraction digit
+     */
+    friend std::ostream& operator<<(std::ostream& os, FixedPoint number)
+    {
+        return os << number.toString();
+    }
+private:
+    /**
+     * @brief value multiplied by Scale
+     */
+    Storage mMinorUnits = 0;
+};
+
+struct MoneyTag {};
+struct PercentTag {};
+struct QuantityTag {};
+
+/**
+ * @brief Amount of money in cents
+ */
+using Money = FixedPoint<MoneyTag, int64_t, MONEY_DIGITS>;
+/**
+ * @brief Percent in hundredths of percent (i.e. 3.5 % holds 350)
+ */
+using Percent = FixedPoint<PercentTag, int32_t, PERCENT_DIGITS>;
+/**
+ * @brief Quantity in thousandths of unit
+ */
+using Quantity = FixedPoint<QuantityTag, int64_t, QUANTITY_DIGITS>;
+
+/**
+ * @brief Calculates unit price including taxes & discount, rounded once to cents.
+ *        Intermediate product is 128 bits wide, so result is exact whenever it fits into Money.
+ *
+ * @exception std::overflow_error if unit price doesn't fit into Money
+ *
+ * @param[in] priceWoTax - price without taxes
+ * @param[in] taxPercent - tax percent
+ * @param[in] discountPercent - discount percent
+ * @return Money - unit price
+ */
+inline Money calculateUnitPrice(Money priceWoTax, Percent taxPercent, Percent discountPercent) noexcept(false)
+{
+    const int64_t hundredPercent = 100 * Percent::Scale;
+    // factors of 32-bit percents can't overflow 64 bits
+    const int64_t factor = (hundredPercent + taxPercent.getMinorUnits()) * (hundredPercent - discountPercent.getMinorUnits());
+    return Money::fromMinorUnits(multiplyDivideRounded(priceWoTax.getMinorUnits(), factor, hundredPercent * hundredPercent));
+}
+
+/**
+ * @brief Calculates price of quantity, rounded once to cents
+ *
+ * @exception std::overflow_error if price doesn't fit into Money
+ *
+ * @param[in] unitPrice - price of single unit
+ * @param[in] quantity - number of units
+ * @return Money - price
+ */
+inline Money calculatePrice(Money unitPrice, Quantity quantity) noexcept(false)
+{
+    return Money::fromMinorUnits(multiplyDivideRounded(unitPrice.getMinorUnits(), quantity.getMinorUnits(), Quantity::Scale));
+}
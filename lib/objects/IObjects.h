@@ -11,10 +11,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <memory>
 
 #include "file_reader/IFileReader.h"
+#include "file_reader/MmapCsvReader.h"
+#include "file_reader/RowErrorReport.h"
 
 /**
  * @brief Shop Objects Interface class
@@ -37,10 +40,94 @@ public:
      * @param[in] reader - file reading handler
      */
     virtual void operator<<(std::shared_ptr<IFileReader> reader) noexcept(false) = 0;
+    /**
+     * @brief Method which shall handle parallel deserialization of shop objects from CSV file.
+     *        Default implementation deserializes file sequentially.
+     *
+     * @exception std::runtime_error reading error
+     *
+     * @param[in] filename - CSV file
+     * @param[in] numThreads - number of threads (0 means hardware concurrency)
+     */
+    virtual void loadParallel(const std::string& filename, size_t numThreads) noexcept(false)
+    {
+        std::shared_ptr<MmapCsvReader> reader = std::make_shared<MmapCsvReader>();
+        (void)numThreads;
+
+        reader->open(filename);
+        *this << reader;
+    }
+    /**
+     * @brief Method which shall map binary snapshot of shop objects instead of CSV deserialization.
+     *        Snapshot which skipped more malformed rows than error budget allows isn't valid.
+     *        Default implementation has no snapshot.
+     *
+     * @param[in] csvFilename - CSV file which snapshot belongs to
+     * @return true - shop objects are taken from snapshot
+     * @return false - there is no valid snapshot, CSV file shall be deserialized
+     */
+    virtual bool loadSnapshot(const std::string& csvFilename)
+    {
+        (void)csvFilename;
+        return false;
+    }
+    /**
+     * @brief Method which shall write binary snapshot of shop objects deserialized from CSV file.
+     *        Default implementation doesn't write anything.
+     *
+     * @exception std::runtime_error if writing has failed
+     *
+     * @param[in] csvFilename - CSV file which shop objects are deserialized from
+     */
+    virtual void saveSnapshot(const std::string& csvFilename) const noexcept(false)
+    {
+        (void)csvFilename;
+    }
     /**
      * @brief Get the Object type (name)
      *
      * @return name in string format
      */
     virtual const char* getObjectType() const = 0;
+
+    /**
+     * @brief Set the error budget of deserialization.
+     *        Lenient deserialization (budget > 0) skips malformed rows & records them in error report,
+     *        strict one (budget 0, default) fails on the first malformed row.
+     *
+     * @param[in] budget - maximal number of skipped rows
+     */
+    void setErrorBudget(size_t budget) { mErrorReport.setBudget(budget); }
+    /**
+     * @brief Get the error report of the last deserialization
+     *
+     * @return const RowErrorReport& - skipped rows
+     */
+    const RowErrorReport& getErrorReport() const { return mErrorReport; }
+    /**
+     * @brief Get the generation of shop objects, unique among all objects & changed on every (even failed) deserialization.
+     *        Data derived from shop objects (i.e. PriceTable) is up to date while generation stays the same.
+     *
+     * @return size_t - generation
+     */
+    size_t getGeneration() const { return mGeneration; }
+protected:
+    /**
+     * @brief report of rows skipped by the last deserialization
+     */
+    RowErrorReport mErrorReport;
+
+    /**
+     * @brief Method which shall be called at the beginning of every deserialization
+     */
+    void nextGeneration() { mGeneration = NextGeneration++; }
+private:
+    /**
+     * @brief Generation counter shared by all shop objects
+     */
+    inline static std::atomic<size_t> NextGeneration = 1;
+    /**
+     * @brief generation of shop objects
+     */
+    size_t mGeneration = NextGeneration++;
 };
@@ -1,12 +1,55 @@
 #include <iostream>
 #include <string>
-#include <regex>
 #include <stdexcept>
+#include <algorithm>
+#include <vector>
 
 #include "Items.h"
+#include "CsvLoader.h"
+#include "file_reader/RowSchema.h"
 
-#define ITEMS_NUM_OF_COLS 4
-#define EAN13_LEN 13
+/**
+ * @brief Item CSV row layout
+ */
+using ItemsSchema = RowSchema<Ean13Column, StringColumn, FixedPointColumn<Money>, FixedPointColumn<Percent>>;
+
+/**
+ * @brief Item record within snapshot
+ */
+struct ItemRecord
+{
+    uint64_t ean13;
+    /**
+     * @brief price in cents & tax percent in hundredths of percent
+     */
+    int64_t priceWoTax;
+    int32_t taxPercent;
+    /**
+     * @brief name within string pool of snapshot
+     */
+    uint32_t nameLength;
+    uint64_t nameOffset;
+};
+
+static_assert(sizeof(ItemRecord) == 32, "Item record shall keep its layout");
+
+/**
+ * @brief Checks that name of item record lies within string pool of snapshot
+ *
+ * @param[in] record - ItemRecord
+ * @param[in] pool - string pool of snapshot
+ * @return true - record is valid
+ * @return false - name is out of pool
+ */
+static bool isItemRecordValid(const void* record, std::string_view pool);
+/**
+ * @brief Makes view of item record
+ *
+ * @param[in] record - validated item record
+ * @param[in] pool - string pool of snapshot
+ * @return Item - item object with name within pool
+ */
+static Item toItem(const ItemRecord& record, std::string_view pool);
 
 bool Item::operator==(const Item& other) const
 {
@@ -27,59 +70,182 @@ bool Item::operator==(const Item& other) const
 
 void Items::operator<<(std::shared_ptr<IFileReader> reader) noexcept(false)
 {
-    Item* item;
-    uint64_t key;
+    Table table;
 
     // clear map
-    mItems.clear();
+    this->clear();
 
-    // pass expected number of columns
-    reader->setNumOfCols(ITEMS_NUM_OF_COLS);
+    // batch reading loop
+    parseRows(*reader, table, mErrorReport);
+    mTable = std::move(table);
+}
 
-    // lambda expression
-    auto validateEan13 = [](const std::string& to_validate, std::string& error)
-    {
-        if (to_validate.length() != EAN13_LEN)
-        {
-            error = "EAN13 shall be 13 digits long.";
-            return false;
-        }
-        return true;
-    };
+void Items::loadParallel(const std::string& filename, size_t numThreads) noexcept(false)
+{
+    Table table;
+
+    // clear map
+    this->clear();
+
+    // parse chunks of file on multiple threads
+    loadRowsParallel(filename, numThreads, table, mErrorReport, &Items::parseRows);
+    mTable = std::move(table);
+}
 
-    // row reading loop
-    while (reader->read())
+const char* Items::getObjectType() const
+{
+    return "Items";
+}
+
+bool Items::loadSnapshot(const std::string& csvFilename)
+{
+    this->clear();
+
+    // names of records are validated together with checksum, records are used in place afterwards
+    return mSnapshot.open(csvFilename, SnapshotType::Items, sizeof(ItemRecord), mErrorReport.getBudget(), isItemRecordValid);
+}
+
+void Items::saveSnapshot(const std::string& csvFilename) const noexcept(false)
+{
+    std::vector<ItemRecord> records;
+    std::string pool;
+
+    // mapped snapshot is up to date already
+    if (mSnapshot.isOpen())
     {
-        // read EAN-13
-        key = reader->extractULongLong(validateEan13);
+        return;
+    }
 
-        // insert map element with EAN-13 key
-        item = &mItems.insert(std::make_pair(key, Item())).first->second;
+    // records are sorted by EAN 13 for binary search
+    records.reserve(mTable.items.size());
+    for (const auto& element : mTable.items)
+    {
+        records.push_back(ItemRecord{element.first, element.second.priceWoTax.getMinorUnits(),
+                                     static_cast<int32_t>(element.second.taxPercent.getMinorUnits()),
+                                     static_cast<uint32_t>(element.second.name.length()), 0});
+    }
+    std::sort(records.begin(), records.end(), [](const ItemRecord& a, const ItemRecord& b)
+    {
+        return a.ean13 < b.ean13;
+    });
 
-        // read product name
-        item->name = reader->extractString();
+    // names are appended in the same order as records
+    for (ItemRecord& record : records)
+    {
+        const Item* item = mTable.items.find(record.ean13);
+        record.nameOffset = pool.length();
+        pool.append(item->name);
+    }
 
-        // read price without taxes
-        item->priceWoTax = reader->extractDouble();
+    Snapshot::write(csvFilename, SnapshotType::Items, records.data(), sizeof(ItemRecord), records.size(), pool,
+                    mErrorReport.getErrors().size());
+}
 
-        // read tax percentage
-        item->taxPercent = reader->extractFloat();
+std::optional<Item> Items::getItem(uint64_t key) const
+{
+    if (mSnapshot.isOpen())
+    {
+        // binary search within mapped records, view of found one points into mapped string pool
+        const ItemRecord* begin = static_cast<const ItemRecord*>(mSnapshot.getRecords());
+        const ItemRecord* end = begin + mSnapshot.getNumOfRecords();
+        const ItemRecord* record = std::lower_bound(begin, end, key, [](const ItemRecord& record, uint64_t key)
+        {
+            return record.ean13 < key;
+        });
+        if (record != end && record->ean13 == key)
+        {
+            return toItem(*record, mSnapshot.getPool());
+        }
+        return std::nullopt;
     }
+
+    const Item* item = mTable.items.find(key);
+    return (item) ? std::optional<Item>(*item) : std::nullopt;
 }
 
-const char* Items::getObjectType() const
+size_t Items::getNumOfItems() const
 {
-    return "Items";
+    return (mSnapshot.isOpen()) ? mSnapshot.getNumOfRecords() : mTable.items.size();
 }
 
-const Item* Items::getItem(uint64_t key) const
+void Items::forEachItem(const std::function<void(uint64_t, const Item&)>& function) const
 {
-    try
+    if (mSnapshot.isOpen())
     {
-        return &mItems.at(key);
+        // item objects are viewed from mapped records one by one
+        const ItemRecord* records = static_cast<const ItemRecord*>(mSnapshot.getRecords());
+        const std::string_view pool = mSnapshot.getPool();
+        for (size_t i = 0; i < mSnapshot.getNumOfRecords(); i++)
+        {
+            function(records[i].ean13, toItem(records[i], pool));
+        }
+        return;
     }
-    catch (...)
+
+    for (const auto& element : mTable.items)
     {
-        return nullptr;
+        function(element.first, element.second);
     }
 }
+
+void Items::Table::merge(Table& other)
+{
+    items.merge(other.items);
+    names.merge(other.names);
+}
+
+void Items::parseRows(IFileReader& reader, Table& table, RowErrorReport& report) noexcept(false)
+{
+    // names are views into rows, so batch of reader which doesn't keep rows holds single row
+    const size_t batchLen = reader.keepsRows() ? ROW_BATCH_LEN : 1;
+    std::vector<uint64_t> keys(batchLen);
+    std::vector<std::string_view> names(batchLen);
+    std::vector<Money> pricesWoTax(batchLen);
+    std::vector<Percent> taxPercents(batchLen);
+    std::vector<RowError> errors;
+    size_t decoded;
+
+    do
+    {
+        // decode batch of rows into columns, malformed rows are recorded (or rejected by error budget)
+        errors.clear();
+        decoded = reader.readBatch<ItemsSchema>(errors, keys, names, pricesWoTax, taxPercents);
+        report.add(errors);
+
+        // insert hash map elements with EAN-13 keys (or overwrite existing ones), names are copied into pool
+        // only once per item (repeated row of item with the same name keeps the stored one)
+        for (size_t i = 0; i < decoded; i++)
+        {
+            Item& item = table.items[keys[i]];
+            if (item.name != names[i])
+            {
+                item.name = table.names.add(names[i]);
+            }
+            item.priceWoTax = pricesWoTax[i];
+            item.taxPercent = taxPercents[i];
+        }
+    } while (decoded == batchLen);
+}
+
+void Items::clear()
+{
+    mTable = Table();
+    mSnapshot.close();
+    mErrorReport.clear();
+    this->nextGeneration();
+}
+
+static bool isItemRecordValid(const void* record, std::string_view pool)
+{
+    const ItemRecord& item = *static_cast<const ItemRecord*>(record);
+    return item.nameOffset <= pool.length() && item.nameLength <= pool.length() - item.nameOffset;
+}
+
+static Item toItem(const ItemRecord& record, std::string_view pool)
+{
+    Item item;
+    item.name = pool.substr(record.nameOffset, record.nameLength);
+    item.priceWoTax = Money::fromMinorUnits(record.priceWoTax);
+    item.taxPercent = Percent::fromMinorUnits(record.taxPercent);
+    return item;
+}
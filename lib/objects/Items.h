@@ -12,31 +12,37 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
-#include <map>
+#include <functional>
 #include <memory>
+#include <optional>
 
+#include "EanMap.h"
+#include "FixedPoint.h"
 #include "IObjects.h"
+#include "Snapshot.h"
+#include "StringPool.h"
 
 class ProcessedOrders;
 
 /**
- * @brief Item object structure
+ * @brief Item object structure (view of item, its name is owned by Items collection)
  */
 struct Item
 {
     /**
-     * @brief item name
+     * @brief item name (owned by Items collection)
      */
-    std::string name;
+    std::string_view name;
     /**
      * @brief item price withouth taxes
      */
-    double priceWoTax;
+    Money priceWoTax;
     /**
      * @brief tax percent for particular item
      */
-    float taxPercent;
+    Percent taxPercent;
 
     /**
      * @brief Overloaded perator.
@@ -81,17 +87,96 @@ public:
      * @return name in string format
      */
     const char* getObjectType() const override;
+    /**
+     * @brief Method which handles parallel deserialization of item objects from CSV file
+     *
+     * @exception RowException reading error with row number
+     * @exception std::runtime_error open file error
+     *
+     * @param[in] filename - CSV file
+     * @param[in] numThreads - number of threads (0 means hardware concurrency)
+     */
+    void loadParallel(const std::string& filename, size_t numThreads) noexcept(false) override;
+    /**
+     * @brief Method which maps snapshot of item objects instead of CSV deserialization
+     *
+     * @param[in] csvFilename - CSV file which snapshot belongs to
+     * @return true - item objects are taken from snapshot
+     * @return false - snapshot is missing, stale, corrupted or it skipped more rows than error budget allows (item objects are cleared)
+     */
+    bool loadSnapshot(const std::string& csvFilename) override;
+    /**
+     * @brief Method which writes snapshot of item objects deserialized from CSV file
+     *
+     * @exception std::runtime_error if writing has failed
+     *
+     * @param[in] csvFilename - CSV file which item objects are deserialized from
+     */
+    void saveSnapshot(const std::string& csvFilename) const noexcept(false) override;
 
     /**
-     * @brief Get the Item object from map
+     * @brief Get the Item object from map (or view of mapped snapshot record)
      *
      * @param[in] key - EAN 13 ID
-     * @return const Item* - pointer to item object if fount it or NULL if not
+     * @return std::optional<Item> - item object if found it or empty if not
+     */
+    std::optional<Item> getItem(uint64_t key) const;
+    /**
+     * @brief Get the number of item objects
+     *
+     * @return size_t - number of deserialized (or mapped) item objects
+     */
+    size_t getNumOfItems() const;
+    /**
+     * @brief Method which calls function for every item object (in unspecified order)
+     *
+     * @param[in] function - function which takes EAN 13 ID & item object
      */
-    const Item* getItem(uint64_t key) const;
+    void forEachItem(const std::function<void(uint64_t, const Item&)>& function) const;
 private:
     /**
-     * @brief Map of Item objects
+     * @brief Item objects deserialized from CSV with storage of their names
+     */
+    struct Table
+    {
+        /**
+         * @brief Map of Item objects
+         */
+        EanMap<Item> items;
+        /**
+         * @brief names of Item objects
+         */
+        StringPool names;
+
+        /**
+         * @brief Method which takes over item objects of other table which are missing within this one
+         *
+         * @param[in, out] other - table to merge
+         */
+        void merge(Table& other);
+    };
+
+    /**
+     * @brief Item objects deserialized from CSV
+     */
+    Table mTable;
+    /**
+     * @brief mapped snapshot, item objects are viewed straight from its records
+     */
+    Snapshot mSnapshot;
+
+    /**
+     * @brief Method which parses every row of reader into table of Item objects (in batches)
+     *
+     * @exception RowException reading error with row number (beyond error budget)
+     *
+     * @param[in] reader - opened file reading handler
+     * @param[out] table - table to insert Item object into
+     * @param[in, out] report - report of skipped rows
+     */
+    static void parseRows(IFileReader& reader, Table& table, RowErrorReport& report) noexcept(false);
+    /**
+     * @brief Method which drops every item object (deserialized or mapped)
      */
-    std::map<uint64_t, Item> mItems;
+    void clear();
 };
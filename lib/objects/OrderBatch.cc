@@ -0,0 +1,290 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "OrderBatch.h"
+#include "Orders.h"
+#include "ProcessedOrders.h"
+#include "bill/TextBillSink.h"
+#include "CsvLoader.h"
+#include "concurrency/WorkStealingScheduler.h"
+#include "file_reader/BufferCsvReader.h"
+#include "file_reader/MmapCsvReader.h"
+
+#define ORDER_FILE_EXTENSION ".csv"
+/**
+ * @brief order file of at least this size is split into chunks
+ */
+#define ORDER_BATCH_SPLIT_LEN (2 * PARALLEL_CHUNK_MIN_LEN)
+
+/**
+ * @brief Coroutine which takes order files one by one, reads file, prices order & writes its bill with asynchronous I/O
+ *
+ * @param[in] io - event loop of thread
+ * @param[in] orderFilenames - order CSV files
+ * @param[in, out] nextFile - index of next file, shared by every coroutine
+ * @param[out] results - outcome of every file
+ * @param[in] prices - price table of batch
+ * @param[in] sink - format of bills
+ * @param[in] errorBudget - maximal number of skipped rows per order file
+ * @param[in] firstOrderNum - order number of the first file
+ * @return IoTask - task which results in 0
+ */
+static IoTask processOrderFiles(AsyncIo& io, const std::vector<std::string>& orderFilenames, std::atomic<size_t>& nextFile,
+                                std::vector<OrderBatchResult>& results, const PriceTable& prices, const IBillSink& sink,
+                                size_t errorBudget, size_t firstOrderNum);
+
+OrderBatch::OrderBatch(const Items& items, const Discounts* discounts) :
+    mBillSink{std::make_shared<TextBillSink>()}
+{
+    mPriceTable.build(items, discounts);
+}
+
+void OrderBatch::setErrorBudget(size_t budget)
+{
+    mErrorBudget = budget;
+}
+
+void OrderBatch::setBillSink(std::shared_ptr<const IBillSink> sink)
+{
+    mBillSink = std::move(sink);
+}
+
+std::vector<OrderBatchResult> OrderBatch::process(const std::vector<std::string>& orderFilenames, size_t numThreads) noexcept(false)
+{
+    std::vector<OrderBatchResult> results(orderFilenames.size());
+    const size_t firstOrderNum = Orders::reserveOrderNums(orderFilenames.size());
+    std::vector<std::unique_ptr<ProcessedOrders>> idleOrders;
+    std::mutex idleOrdersMutex;
+
+    // every file is task, big one splits into subtasks which idle workers steal
+    WorkStealingScheduler scheduler(numThreads);
+    TaskGroup group;
+    for (size_t i = 0; i < orderFilenames.size(); i++)
+    {
+        scheduler.submit(group, [this, &orderFilenames, &results, &idleOrders, &idleOrdersMutex, &scheduler, firstOrderNum, i]()
+        {
+            OrderBatchResult& result = results[i];
+            std::unique_ptr<ProcessedOrders> processedOrders;
+            std::error_code error;
+            std::ofstream writer;
+
+            result.orderFilename = orderFilenames[i];
+            result.orderNum = firstOrderNum + i;
+
+            // reuse processed orders (& their arena) of finished task, every running task holds its own one
+            {
+                std::lock_guard<std::mutex> lock(idleOrdersMutex);
+                if (!idleOrders.empty())
+                {
+                    processedOrders = std::move(idleOrders.back());
+                    idleOrders.pop_back();
+                }
+            }
+            if (!processedOrders)
+            {
+                processedOrders = std::make_unique<ProcessedOrders>();
+            }
+            processedOrders->setErrorBudget(mErrorBudget);
+
+            try
+            {
+                if (std::filesystem::file_size(orderFilenames[i], error) >= ORDER_BATCH_SPLIT_LEN && !error)
+                {
+                    processedOrders->processOrder(orderFilenames[i], mPriceTable, result.orderNum, scheduler);
+                }
+                else
+                {
+                    // price order while it is read
+                    MmapCsvReader reader;
+                    reader.open(orderFilenames[i]);
+                    processedOrders->processOrder(reader, mPriceTable, result.orderNum);
+                }
+                result.numOfRows = processedOrders->getNumOfRows();
+                result.total = processedOrders->getTotal();
+                result.skippedRows = processedOrders->getErrorReport().getErrors();
+
+                // write bill
+                result.billFilename = mBillSink->getBillFilename(result.orderNum);
+                writer.open(result.billFilename, mBillSink->getOpenMode());
+                processedOrders->writeBill(writer, *mBillSink);
+                writer.close();
+                if (!writer)
+                {
+                    throw std::runtime_error("Failed to write " + result.billFilename);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                result.billFilename.clear();
+                result.error = e.what();
+            }
+
+            std::lock_guard<std::mutex> lock(idleOrdersMutex);
+            idleOrders.push_back(std::move(processedOrders));
+        });
+    }
+    scheduler.wait(group);
+    return results;
+}
+
+std::vector<OrderBatchResult> OrderBatch::processAsync(const std::vector<std::string>& orderFilenames, size_t numThreads, size_t numInFlight,
+                                                       AsyncIo::Backend backend) noexcept(false)
+{
+    std::vector<OrderBatchResult> results(orderFilenames.size());
+    const size_t firstOrderNum = Orders::reserveOrderNums(orderFilenames.size());
+    std::atomic<size_t> nextFile = 0;
+
+    if (!numThreads)
+    {
+        numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    numInFlight = std::max<size_t>(1, numInFlight);
+
+    // every thread runs its own event loop, coroutines of every thread take files from the same index
+    std::vector<std::exception_ptr> failures(numThreads);
+    const auto run = [&](size_t thread)
+    {
+        try
+        {
+            AsyncIo io(numInFlight, backend);
+            for (size_t i = 0; i < numInFlight; i++)
+            {
+                processOrderFiles(io, orderFilenames, nextFile, results, mPriceTable, *mBillSink, mErrorBudget, firstOrderNum).start();
+            }
+            io.run();
+        }
+        catch (...)
+        {
+            // failure of event loop (not of single file) is rethrown once every thread has finished
+            failures[thread] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; i++)
+    {
+        threads.emplace_back(run, i);
+    }
+    run(0);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    for (const std::exception_ptr& failure : failures)
+    {
+        if (failure)
+        {
+            std::rethrow_exception(failure);
+        }
+    }
+    return results;
+}
+
+std::vector<std::string> OrderBatch::listOrderFiles(const std::string& path) noexcept(false)
+{
+    std::vector<std::string> filenames;
+    std::error_code error;
+
+    if (std::filesystem::is_directory(path, error))
+    {
+        // every CSV file of directory, sorted so order numbers don't depend on file system
+        for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(path, error))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ORDER_FILE_EXTENSION)
+            {
+                filenames.push_back(entry.path().string());
+            }
+        }
+        if (error)
+        {
+            throw std::runtime_error("Can't list directory " + path + ": " + error.message());
+        }
+        std::sort(filenames.begin(), filenames.end());
+        return filenames;
+    }
+
+    std::ifstream manifest(path);
+    if (!manifest.is_open())
+    {
+        throw std::runtime_error("Can't open batch " + path);
+    }
+
+    // one file per line, empty lines are skipped
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    std::string line;
+    while (std::getline(manifest, line))
+    {
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        line.erase(0, line.find_first_not_of(" \t"));
+        if (!line.empty())
+        {
+            const std::filesystem::path filename(line);
+            filenames.push_back((filename.is_absolute()) ? line : (directory / filename).string());
+        }
+    }
+    return filenames;
+}
+
+static IoTask processOrderFiles(AsyncIo& io, const std::vector<std::string>& orderFilenames, std::atomic<size_t>& nextFile,
+                                std::vector<OrderBatchResult>& results, const PriceTable& prices, const IBillSink& sink,
+                                size_t errorBudget, size_t firstOrderNum)
+{
+    // buffers are kept within coroutine & reused by following files
+    ProcessedOrders processedOrders;
+    BufferCsvReader reader;
+    std::string content;
+    std::string_view bill;
+
+    processedOrders.setErrorBudget(errorBudget);
+    for (size_t i = nextFile++; i < orderFilenames.size(); i = nextFile++)
+    {
+        OrderBatchResult& result = results[i];
+        result.orderFilename = orderFilenames[i];
+        result.orderNum = firstOrderNum + i;
+
+        // other coroutines price their orders while file is read
+        if (co_await AsyncIo::readFile(io, orderFilenames[i], content) < 0)
+        {
+            result.error = "Failed to open file " + orderFilenames[i];
+            continue;
+        }
+
+        try
+        {
+            // price order from buffer
+            reader.open(orderFilenames[i], std::move(content));
+            processedOrders.processOrder(reader, prices, result.orderNum);
+            result.numOfRows = processedOrders.getNumOfRows();
+            result.total = processedOrders.getTotal();
+            result.skippedRows = processedOrders.getErrorReport().getErrors();
+
+            // render bill into memory (within arena of processed orders)
+            bill = processedOrders.formatBill(sink);
+            result.billFilename = sink.getBillFilename(result.orderNum);
+        }
+        catch (const std::exception& e)
+        {
+            result.error = e.what();
+        }
+        content = reader.release();
+        if (!result.error.empty())
+        {
+            continue;
+        }
+
+        // write bill
+        if (co_await AsyncIo::writeFile(io, result.billFilename, bill) < 0)
+        {
+            result.error = "Failed to write " + result.billFilename;
+            result.billFilename.clear();
+        }
+    }
+    co_return 0;
+}
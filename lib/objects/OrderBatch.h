@@ -0,0 +1,144 @@
+/**
+ * @file OrderBatch.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief OrderBatchResult structure & OrderBatch class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Items.h"
+#include "Discounts.h"
+#include "FixedPoint.h"
+#include "PriceTable.h"
+#include "bill/IBillSink.h"
+#include "file_reader/RowErrorReport.h"
+#include "io/AsyncIo.h"
+
+/**
+ * @brief Outcome of single order file of batch
+ */
+struct OrderBatchResult
+{
+    /**
+     * @brief order CSV file
+     */
+    std::string orderFilename;
+    /**
+     * @brief written bill (empty if order has failed)
+     */
+    std::string billFilename;
+    /**
+     * @brief order number, given by position of file within batch
+     */
+    size_t orderNum = 0;
+    /**
+     * @brief number of read rows (including skipped ones)
+     */
+    size_t numOfRows = 0;
+    /**
+     * @brief total price of order
+     */
+    Money total;
+    /**
+     * @brief skipped rows (within error budget)
+     */
+    std::vector<RowError> skippedRows;
+    /**
+     * @brief reason of failure (empty on success)
+     */
+    std::string error;
+};
+
+/**
+ * @brief Processes many order files concurrently against one read only catalog.
+ *        Items & discounts are joined into single price table shared by every worker thread.
+ *        Every order file is task of work stealing scheduler, big file is split into chunks & ranges of lines
+ *        which idle workers steal, so few giant orders don't keep the other workers idle.
+ *        ProcessedOrders (& their arenas) are reused by following tasks.
+ *        Items & discounts shall stay unchanged while batch is processed.
+ */
+class OrderBatch
+{
+public:
+    /**
+     * @brief Construct a new OrderBatch object & join items with discounts
+     *
+     * @param[in] items - items values without discount calculation, shall outlive batch
+     * @param[in] discounts - discounts (optional/nullable)
+     */
+    OrderBatch(const Items& items, const Discounts* discounts = nullptr);
+
+    /**
+     * @brief Set the error budget of every order file, see IObjects::setErrorBudget
+     *
+     * @param[in] budget - maximal number of skipped rows per order file
+     */
+    void setErrorBudget(size_t budget);
+    /**
+     * @brief Set the format of written bills (text bills by default)
+     *
+     * @param[in] sink - bill sink, shared by every worker
+     */
+    void setBillSink(std::shared_ptr<const IBillSink> sink);
+
+    /**
+     * @brief Method which prices every order file & writes its bill (processed_order_<order num>.<extension of bill sink>).
+     *        Order numbers are reserved for whole batch, so file gets the same number regardless of thread timing.
+     *        Failed order doesn't stop the others, its failure is reported within result.
+     *
+     * @param[in] orderFilenames - order CSV files
+     * @param[in] numThreads - number of worker threads (0 means hardware concurrency)
+     * @return std::vector<OrderBatchResult> - outcome of every file in order of files
+     */
+    std::vector<OrderBatchResult> process(const std::vector<std::string>& orderFilenames, size_t numThreads) noexcept(false);
+    /**
+     * @brief Method which prices every order file like process, but order files are read & bills are written
+     *        with asynchronous I/O (see AsyncIo). Every thread runs event loop of numInFlight coroutines,
+     *        each of them reads whole order file, prices it from buffer & writes its bill,
+     *        so coroutine prices its order while files of the other ones are read or written.
+     *        Whole order file is kept in memory, so it suits many small orders.
+     *
+     * @exception std::runtime_error if event loop of any thread has failed (rethrown once every thread has finished)
+     *
+     * @param[in] orderFilenames - order CSV files
+     * @param[in] numThreads - number of event loop threads (0 means hardware concurrency)
+     * @param[in] numInFlight - number of coroutines (files in flight) per thread
+     * @param[in] backend - implementation of I/O requests
+     * @return std::vector<OrderBatchResult> - outcome of every file in order of files
+     */
+    std::vector<OrderBatchResult> processAsync(const std::vector<std::string>& orderFilenames, size_t numThreads, size_t numInFlight,
+                                               AsyncIo::Backend backend = AsyncIo::Backend::Auto) noexcept(false);
+
+    /**
+     * @brief Lists order files of batch
+     *
+     * @exception std::runtime_error if path can't be read
+     *
+     * @param[in] path - directory (every *.csv file within it, sorted by name)
+     *                   or manifest (one order file per line, relative to directory of manifest)
+     * @return std::vector<std::string> - order CSV files
+     */
+    static std::vector<std::string> listOrderFiles(const std::string& path) noexcept(false);
+private:
+    /**
+     * @brief unit prices of items with discounts, read by every worker
+     */
+    PriceTable mPriceTable;
+    /**
+     * @brief maximal number of skipped rows per order file
+     */
+    size_t mErrorBudget = 0;
+    /**
+     * @brief format of written bills
+     */
+    std::shared_ptr<const IBillSink> mBillSink;
+};
@@ -0,0 +1,339 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "OrderPipeline.h"
+#include "Orders.h"
+#include "ProcessedOrders.h"
+#include "bill/TextBillSink.h"
+#include "concurrency/BoundedQueue.h"
+#include "file_reader/MmapCsvReader.h"
+
+#define STAGE_PARSE 0
+#define STAGE_PRICE 1
+#define STAGE_WRITE 2
+#define NUM_OF_STAGES 3
+
+/**
+ * @brief Order passed from parse to price stage
+ */
+struct ParsedOrder
+{
+    size_t index = 0;
+    Orders* orders = nullptr;
+};
+
+/**
+ * @brief Order passed from price to write stage
+ */
+struct PricedOrder
+{
+    size_t index = 0;
+    ProcessedOrders* processedOrders = nullptr;
+};
+
+/**
+ * @brief Measurements of single thread, added to stage measurements once thread finishes
+ */
+struct StageCounters
+{
+    size_t numOfOrders = 0;
+    double busyMs = 0;
+    double starvedMs = 0;
+    double blockedMs = 0;
+    /**
+     * @brief depth of output queue found by every push
+     */
+    size_t numOfPushes = 0;
+    size_t sumOfDepths = 0;
+    size_t maxDepth = 0;
+};
+
+/**
+ * @brief Get the time elapsed since previous lap
+ *
+ * @param[in, out] since - beginning of lap, set to now
+ * @return double - elapsed time in milliseconds
+ */
+static double lapMs(std::chrono::steady_clock::time_point& since);
+/**
+ * @brief Pushes value into output queue of stage, time of backpressure & depth of queue (before push) are measured
+ *
+ * @param[in] queue - output queue
+ * @param[in] value - value to push
+ * @param[in, out] counters - measurements of thread
+ * @param[in, out] since - beginning of lap
+ */
+template <typename T>
+static void pushMeasured(BoundedQueue<T>& queue, T value, StageCounters& counters, std::chrono::steady_clock::time_point& since);
+
+OrderPipeline::OrderPipeline(const Items& items, const Discounts* discounts) :
+    mBillSink{std::make_shared<TextBillSink>()}
+{
+    mPriceTable.build(items, discounts);
+}
+
+void OrderPipeline::setErrorBudget(size_t budget)
+{
+    mErrorBudget = budget;
+}
+
+void OrderPipeline::setBillSink(std::shared_ptr<const IBillSink> sink)
+{
+    mBillSink = std::move(sink);
+}
+
+std::vector<OrderBatchResult> OrderPipeline::process(const std::vector<std::string>& orderFilenames, const OrderPipelineConfig& config) noexcept(false)
+{
+    const size_t numOfThreads[NUM_OF_STAGES] =
+    {
+        std::max<size_t>(1, config.parseThreads),
+        std::max<size_t>(1, config.priceThreads),
+        std::max<size_t>(1, config.writeThreads)
+    };
+    const size_t capacity = std::max<size_t>(1, config.queueCapacity);
+    std::vector<OrderBatchResult> results(orderFilenames.size());
+    const size_t firstOrderNum = Orders::reserveOrderNums(orderFilenames.size());
+
+    // queues between stages
+    BoundedQueue<ParsedOrder> parsedOrders(capacity);
+    BoundedQueue<PricedOrder> pricedOrders(capacity);
+
+    // Orders & ProcessedOrders circulate, so every thread & queued order may hold one of them
+    const size_t numOfOrders = numOfThreads[STAGE_PARSE] + capacity + numOfThreads[STAGE_PRICE];
+    const size_t numOfProcessedOrders = numOfThreads[STAGE_PRICE] + capacity + numOfThreads[STAGE_WRITE];
+    std::vector<std::unique_ptr<Orders>> ordersStorage;
+    std::vector<std::unique_ptr<ProcessedOrders>> processedOrdersStorage;
+    BoundedQueue<Orders*> freeOrders(numOfOrders);
+    BoundedQueue<ProcessedOrders*> freeProcessedOrders(numOfProcessedOrders);
+    for (size_t i = 0; i < numOfOrders; i++)
+    {
+        ordersStorage.push_back(std::make_unique<Orders>());
+        ordersStorage.back()->setErrorBudget(mErrorBudget);
+        freeOrders.push(ordersStorage.back().get());
+    }
+    for (size_t i = 0; i < numOfProcessedOrders; i++)
+    {
+        processedOrdersStorage.push_back(std::make_unique<ProcessedOrders>());
+        freeProcessedOrders.push(processedOrdersStorage.back().get());
+    }
+
+    // measurements of stages
+    std::mutex statsMutex;
+    size_t numOfPushes[NUM_OF_STAGES] = {};
+    size_t sumOfDepths[NUM_OF_STAGES] = {};
+    mStageStats.assign(NUM_OF_STAGES, PipelineStageStats());
+    mStageStats[STAGE_PARSE].name = "parse";
+    mStageStats[STAGE_PRICE].name = "price";
+    mStageStats[STAGE_WRITE].name = "write";
+    mStageStats[STAGE_PRICE].queueCapacity = capacity;
+    mStageStats[STAGE_WRITE].queueCapacity = capacity;
+    const auto addCounters = [&](size_t stage, const StageCounters& counters)
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        mStageStats[stage].numOfOrders += counters.numOfOrders;
+        mStageStats[stage].busyMs += counters.busyMs;
+        mStageStats[stage].starvedMs += counters.starvedMs;
+        mStageStats[stage].blockedMs += counters.blockedMs;
+
+        // pushes fill input queue of next stage
+        if (stage + 1 < NUM_OF_STAGES)
+        {
+            numOfPushes[stage + 1] += counters.numOfPushes;
+            sumOfDepths[stage + 1] += counters.sumOfDepths;
+            mStageStats[stage + 1].maxQueueDepth = std::max(mStageStats[stage + 1].maxQueueDepth, counters.maxDepth);
+        }
+    };
+
+    // the last thread of stage closes its output queue
+    std::atomic<size_t> nextFile = 0;
+    std::atomic<size_t> parseThreadsLeft = numOfThreads[STAGE_PARSE];
+    std::atomic<size_t> priceThreadsLeft = numOfThreads[STAGE_PRICE];
+
+    const auto parse = [&]()
+    {
+        StageCounters counters;
+        MmapCsvReader reader;
+        Orders* orders = nullptr;
+        std::chrono::steady_clock::time_point since = std::chrono::steady_clock::now();
+
+        for (size_t i = nextFile++; i < orderFilenames.size(); i = nextFile++)
+        {
+            OrderBatchResult& result = results[i];
+            result.orderFilename = orderFilenames[i];
+            result.orderNum = firstOrderNum + i;
+
+            // free Orders run out only if price stage keeps all of them (pool is never closed, so pop waits for one)
+            freeOrders.pop(orders);
+            counters.blockedMs += lapMs(since);
+
+            try
+            {
+                reader.open(orderFilenames[i]);
+                orders->load(reader, result.orderNum);
+                result.numOfRows = reader.getRowNum();
+                result.skippedRows = orders->getErrorReport().getErrors();
+            }
+            catch (const std::exception& e)
+            {
+                result.error = e.what();
+                freeOrders.push(orders);
+                orders = nullptr;
+            }
+            counters.numOfOrders++;
+            counters.busyMs += lapMs(since);
+
+            if (orders)
+            {
+                pushMeasured(parsedOrders, ParsedOrder{i, orders}, counters, since);
+            }
+        }
+
+        if (parseThreadsLeft.fetch_sub(1) == 1)
+        {
+            parsedOrders.close();
+        }
+        addCounters(STAGE_PARSE, counters);
+    };
+
+    const auto price = [&]()
+    {
+        StageCounters counters;
+        ParsedOrder parsedOrder;
+        ProcessedOrders* processedOrders = nullptr;
+        std::chrono::steady_clock::time_point since = std::chrono::steady_clock::now();
+
+        while (parsedOrders.pop(parsedOrder))
+        {
+            OrderBatchResult& result = results[parsedOrder.index];
+            counters.starvedMs += lapMs(since);
+
+            // free ProcessedOrders run out only if write stage keeps all of them (pool is never closed, so pop waits for one)
+            freeProcessedOrders.pop(processedOrders);
+            counters.blockedMs += lapMs(since);
+
+            try
+            {
+                processedOrders->processOrder(*parsedOrder.orders, mPriceTable);
+                result.total = processedOrders->getTotal();
+            }
+            catch (const std::exception& e)
+            {
+                result.error = e.what();
+                freeProcessedOrders.push(processedOrders);
+                processedOrders = nullptr;
+            }
+            freeOrders.push(parsedOrder.orders);
+            counters.numOfOrders++;
+            counters.busyMs += lapMs(since);
+
+            if (processedOrders)
+            {
+                pushMeasured(pricedOrders, PricedOrder{parsedOrder.index, processedOrders}, counters, since);
+            }
+        }
+        counters.starvedMs += lapMs(since);
+
+        if (priceThreadsLeft.fetch_sub(1) == 1)
+        {
+            pricedOrders.close();
+        }
+        addCounters(STAGE_PRICE, counters);
+    };
+
+    const auto write = [&]()
+    {
+        StageCounters counters;
+        PricedOrder pricedOrder;
+        std::ofstream writer;
+        std::chrono::steady_clock::time_point since = std::chrono::steady_clock::now();
+
+        while (pricedOrders.pop(pricedOrder))
+        {
+            OrderBatchResult& result = results[pricedOrder.index];
+            counters.starvedMs += lapMs(since);
+
+            try
+            {
+                result.billFilename = mBillSink->getBillFilename(result.orderNum);
+                writer.open(result.billFilename, mBillSink->getOpenMode());
+                pricedOrder.processedOrders->writeBill(writer, *mBillSink);
+                writer.close();
+                if (!writer)
+                {
+                    throw std::runtime_error("Failed to write " + result.billFilename);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                writer.close();
+                writer.clear();
+                result.billFilename.clear();
+                result.error = e.what();
+            }
+            freeProcessedOrders.push(pricedOrder.processedOrders);
+            counters.numOfOrders++;
+            counters.busyMs += lapMs(since);
+        }
+        counters.starvedMs += lapMs(since);
+
+        addCounters(STAGE_WRITE, counters);
+    };
+
+    // every stage runs on its own threads
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numOfThreads[STAGE_PARSE]; i++)
+    {
+        threads.emplace_back(parse);
+    }
+    for (size_t i = 0; i < numOfThreads[STAGE_PRICE]; i++)
+    {
+        threads.emplace_back(price);
+    }
+    for (size_t i = 0; i < numOfThreads[STAGE_WRITE]; i++)
+    {
+        threads.emplace_back(write);
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t stage = 0; stage < NUM_OF_STAGES; stage++)
+    {
+        mStageStats[stage].numOfThreads = numOfThreads[stage];
+        mStageStats[stage].meanQueueDepth = (numOfPushes[stage]) ? static_cast<double>(sumOfDepths[stage]) / numOfPushes[stage] : 0;
+    }
+    return results;
+}
+
+const std::vector<PipelineStageStats>& OrderPipeline::getStageStats() const
+{
+    return mStageStats;
+}
+
+static double lapMs(std::chrono::steady_clock::time_point& since)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const double elapsed = std::chrono::duration<double, std::milli>(now - since).count();
+    since = now;
+    return elapsed;
+}
+
+template <typename T>
+static void pushMeasured(BoundedQueue<T>& queue, T value, StageCounters& counters, std::chrono::steady_clock::time_point& since)
+{
+    // depth found by push, so empty queue counts as 0 (after push it would be at least 1)
+    const size_t depth = queue.size();
+    counters.numOfPushes++;
+    counters.sumOfDepths += depth;
+    counters.maxDepth = std::max(counters.maxDepth, depth);
+
+    queue.push(std::move(value));
+    counters.blockedMs += lapMs(since);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file OrderPipeline.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief OrderPipelineConfig & PipelineStageStats structures & OrderPipeline class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Items.h"
+#include "Discounts.h"
+#include "OrderBatch.h"
+#include "PriceTable.h"
+
+/**
+ * @brief Number of threads of every stage & capacity of queues between them
+ */
+struct OrderPipelineConfig
+{
+    /**
+     * @brief threads which deserialize order files into Orders
+     */
+    size_t parseThreads = 1;
+    /**
+     * @brief threads which process Orders into ProcessedOrders
+     */
+    size_t priceThreads = 1;
+    /**
+     * @brief threads which write bills of ProcessedOrders
+     */
+    size_t writeThreads = 1;
+    /**
+     * @brief maximal number of orders waiting in front of price & write stage,
+     *        stage in front of full queue waits (backpressure)
+     */
+    size_t queueCapacity = 4;
+};
+
+/**
+ * @brief Measurements of single stage
+ */
+struct PipelineStageStats
+{
+    /**
+     * @brief name of stage ("parse", "price" or "write")
+     */
+    std::string name;
+    /**
+     * @brief number of threads of stage
+     */
+    size_t numOfThreads = 0;
+    /**
+     * @brief number of orders taken by stage
+     */
+    size_t numOfOrders = 0;
+    /**
+     * @brief time spent on orders, summed over threads of stage
+     */
+    double busyMs = 0;
+    /**
+     * @brief time spent waiting on empty input queue, summed over threads of stage
+     */
+    double starvedMs = 0;
+    /**
+     * @brief time spent waiting on full output queue (backpressure), summed over threads of stage
+     */
+    double blockedMs = 0;
+    /**
+     * @brief capacity of input queue (0 for the first stage, which takes order files)
+     */
+    size_t queueCapacity = 0;
+    /**
+     * @brief the biggest depth of input queue found by pushes (before pushed order)
+     */
+    size_t maxQueueDepth = 0;
+    /**
+     * @brief average depth of input queue found by pushes (before pushed order)
+     */
+    double meanQueueDepth = 0;
+};
+
+/**
+ * @brief Processes many order files in three stages which run at the same time on their own threads:
+ *        parse (order file into Orders), price (Orders into ProcessedOrders) & write (bill of ProcessedOrders).
+ *        Stages are connected by bounded queues, so disk reads & writes of some orders overlap pricing of others
+ *        and fast stage waits for slow one instead of piling up orders. Depth of queues shows the bottleneck:
+ *        full queue is in front of the slowest stage. Orders & ProcessedOrders (& their arenas) circulate
+ *        between stages, so their number is bounded by threads & queue capacity.
+ *        Results (bills, order numbers & totals) are the same as the ones of OrderBatch.
+ *        Items & discounts shall stay unchanged while orders are processed.
+ */
+class OrderPipeline
+{
+public:
+    /**
+     * @brief Construct a new OrderPipeline object & join items with discounts
+     *
+     * @param[in] items - items values without discount calculation, shall outlive pipeline
+     * @param[in] discounts - discounts (optional/nullable)
+     */
+    OrderPipeline(const Items& items, const Discounts* discounts = nullptr);
+
+    /**
+     * @brief Set the error budget of every order file, see IObjects::setErrorBudget
+     *
+     * @param[in] budget - maximal number of skipped rows per order file
+     */
+    void setErrorBudget(size_t budget);
+    /**
+     * @brief Set the format of written bills (text bills by default)
+     *
+     * @param[in] sink - bill sink, shared by every worker
+     */
+    void setBillSink(std::shared_ptr<const IBillSink> sink);
+
+    /**
+     * @brief Method which prices every order file & writes its bill (processed_order_<order num>.<extension of bill sink>).
+     *        Order numbers are reserved for whole batch, so file gets the same number regardless of thread timing.
+     *        Failed order doesn't stop the others, its failure is reported within result.
+     *
+     * @param[in] orderFilenames - order CSV files
+     * @param[in] config - threads of stages & capacity of queues (0 threads means 1)
+     * @return std::vector<OrderBatchResult> - outcome of every file in order of files
+     */
+    std::vector<OrderBatchResult> process(const std::vector<std::string>& orderFilenames, const OrderPipelineConfig& config) noexcept(false);
+
+    /**
+     * @brief Get the measurements of every stage of last process call (in order of stages)
+     *
+     * @return const std::vector<PipelineStageStats>& - stage measurements
+     */
+    const std::vector<PipelineStageStats>& getStageStats() const;
+private:
+    /**
+     * @brief unit prices of items with discounts, read by every price thread
+     */
+    PriceTable mPriceTable;
+    /**
+     * @brief maximal number of skipped rows per order file
+     */
+    size_t mErrorBudget = 0;
+    /**
+     * @brief format of written bills
+     */
+    std::shared_ptr<const IBillSink> mBillSink;
+    /**
+     * @brief measurements of stages
+     */
+    std::vector<PipelineStageStats> mStageStats;
+};
@@ -1,7 +1,5 @@
 #include "Orders.h"
-
-#define ORDERS_NUM_OF_COLS 2
-#define EAN13_LEN 13
+#include "CsvLoader.h"
 
 bool Order::operator==(const Order& other) const
 {
@@ -14,43 +12,89 @@ bool Order::operator==(const Order& other) const
 
 void Orders::operator<<(std::shared_ptr<IFileReader> reader) noexcept(false)
 {
-    Order* item;
-    uint64_t key;
+    // number is taken only by successful deserialization
+    this->load(*reader, 0);
+    mOrderNum = Orders::reserveOrderNums(1);
+}
 
-    // clear map
+void Orders::load(IFileReader& reader, size_t orderNum) noexcept(false)
+{
+    // clear map & reuse its memory
     mOrders.clear();
+    mArena.reset();
+    mErrorReport.clear();
+    this->nextGeneration();
 
-    // pass expected number of columns
-    reader->setNumOfCols(ORDERS_NUM_OF_COLS);
+    // batch reading loop
+    parseRows(reader, mOrders, mErrorReport);
 
-    // lambda expression
-    auto validateEan13 = [](const std::string& to_validate, std::string& error)
-    {
-        if (to_validate.length() != EAN13_LEN)
-        {
-            error = "EAN13 shall be 13 digits long.";
-            return false;
-        }
-        return true;
-    };
+    mOrderNum = orderNum;
+}
 
-    // row reading loop
-    while (reader->read())
-    {
-        // read EAN-13
-        key = reader->extractULongLong(validateEan13);
+void Orders::loadParallel(const std::string& filename, size_t numThreads) noexcept(false)
+{
+    WorkStealingScheduler scheduler(numThreads);
+    this->loadParallel(filename, scheduler);
+}
 
-        // insert map element with EAN-13 key
-        item = &mOrders.insert(std::make_pair(key, Order())).first->second;
+void Orders::loadParallel(const std::string& filename, WorkStealingScheduler& scheduler) noexcept(false)
+{
+    // clear map & reuse its memory
+    mOrders.clear();
+    mArena.reset();
+    mErrorReport.clear();
+    this->nextGeneration();
 
-        // read quantity
-        item->quantity = reader->extractFloat();
-    }
+    // chunks are parsed into partial maps & summed up
+    loadRowsStealing(filename, scheduler, mOrders, mErrorReport, &Orders::parseRows, &Orders::mergeOrders);
 
-    mOrderNum = Orders::OrderCount++;
+    mOrderNum = Orders::reserveOrderNums(1);
 }
 
 const char* Orders::getObjectType() const
 {
     return "Orders";
 }
+
+const Arena& Orders::getArena() const
+{
+    return mArena;
+}
+
+size_t Orders::getOrderNum() const
+{
+    return mOrderNum;
+}
+
+size_t Orders::reserveOrderNums(size_t count)
+{
+    return OrderCount.fetch_add(count);
+}
+
+void Orders::parseRows(IFileReader& reader, EanMap<Order>& orders, RowErrorReport& report) noexcept(false)
+{
+    // batch buffers share memory resource of orders
+    std::pmr::vector<uint64_t> keys(ROW_BATCH_LEN, orders.getResource());
+    std::pmr::vector<Quantity> quantities(ROW_BATCH_LEN, orders.getResource());
+    std::vector<RowError> errors;
+    size_t decoded;
+
+    do
+    {
+        // decode batch of rows into columns, malformed rows are recorded (or rejected by error budget)
+        errors.clear();
+        decoded = reader.readBatch<OrdersSchema>(errors, keys, quantities);
+        report.add(errors);
+
+        // insert hash map elements with EAN-13 keys, quantities of repeated keys are summed up
+        for (size_t i = 0; i < decoded; i++)
+        {
+            orders[keys[i]].quantity += quantities[i];
+        }
+    } while (decoded == ROW_BATCH_LEN);
+}
+
+void Orders::mergeOrders(EanMap<Order>& orders, EanMap<Order>& other)
+{
+    orders.merge(other, [](Order& order, const Order& otherOrder) { order.quantity += otherOrder.quantity; });
+}
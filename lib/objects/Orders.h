@@ -11,11 +11,16 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
-#include <map>
 #include <memory>
 
+#include "EanMap.h"
+#include "FixedPoint.h"
 #include "IObjects.h"
+#include "concurrency/WorkStealingScheduler.h"
+#include "file_reader/RowSchema.h"
+#include "memory/Arena.h"
 
 class ProcessedOrders;
 
@@ -31,7 +36,7 @@ struct Order
     /**
      * @brief order quantity
      */
-    float quantity;
+    Quantity quantity;
 
     /**
      * @brief Overloaded perator.
@@ -48,9 +53,17 @@ struct Order
     inline bool operator!=(const Order& other) const { return !(*this == other); }
 };
 
+/**
+ * @brief Order CSV row layout
+ */
+using OrdersSchema = RowSchema<Ean13Column, FixedPointColumn<Quantity>>;
+
 /**
  * @brief Order objects collection class
- *        handles deserialization of order objects in combination with IFileReader
+ *        handles deserialization of order objects in combination with IFileReader.
+ *        Rows of the same EAN 13 are aggregated into single order with sum of their quantities.
+ *        Orders are kept within arena which is reset by every deserialization,
+ *        so object reused for many orders stops allocating once it has seen the biggest one.
  */
 class Orders : public IObjects
 {
@@ -70,24 +83,98 @@ public:
      * @param[in] reader - file reading handler
      */
     void operator<<(std::shared_ptr<IFileReader> reader) noexcept(false) override;
+    /**
+     * @brief Method which handles deserialization of order objects with order number reserved beforehand
+     *        (see reserveOrderNums), i.e. batch of orders deserialized on many threads
+     *
+     * @exception std::runtime_error reading error
+     *
+     * @param[in] reader - opened file reading handler
+     * @param[in] orderNum - order number
+     */
+    void load(IFileReader& reader, size_t orderNum) noexcept(false);
+    /**
+     * @brief Method which handles parallel deserialization of order objects with work stealing scheduler
+     *
+     * @exception std::runtime_error reading error
+     *
+     * @param[in] filename - CSV file
+     * @param[in] numThreads - number of threads (0 means hardware concurrency)
+     */
+    void loadParallel(const std::string& filename, size_t numThreads) noexcept(false) override;
+    /**
+     * @brief Method which handles deserialization of order objects as tasks of scheduler.
+     *        Chunks of big file are stolen by idle workers, result is the same as sequential deserialization.
+     *        May be called from task of the same scheduler.
+     *
+     * @exception std::runtime_error reading error
+     *
+     * @param[in] filename - CSV file
+     * @param[in] scheduler - scheduler of chunks
+     */
+    void loadParallel(const std::string& filename, WorkStealingScheduler& scheduler) noexcept(false);
     /**
      * @brief Get the Object type (name)
      *
      * @return name in string format
      */
     const char* getObjectType() const override;
+    /**
+     * @brief Get the arena of orders (allocation counters)
+     *
+     * @return const Arena& - arena of orders
+     */
+    const Arena& getArena() const;
+    /**
+     * @brief Get the order number
+     *
+     * @return size_t - order number of last deserialization
+     */
+    size_t getOrderNum() const;
+
+    /**
+     * @brief Method which reserves consecutive order numbers (thread safe),
+     *        i.e. batch of order files gets numbers in order of files regardless of processing order
+     *
+     * @param[in] count - number of orders
+     * @return size_t - the first reserved order number
+     */
+    static size_t reserveOrderNums(size_t count);
 private:
     /**
-     * @brief Map of Order objects
+     * @brief Memory of orders & batch buffers, reset by every deserialization
      */
-    std::map<uint64_t, Order> mOrders;
+    Arena mArena;
+    /**
+     * @brief Hash map of Order objects (within arena)
+     */
+    EanMap<Order> mOrders{&mArena};
     /**
      * @brief Order Number
      */
     size_t mOrderNum = 0;
 
     /**
-     * @brief Static order counter. Increases on every succesfully deserialization
+     * @brief Static order counter. Increases on every succesfully deserialization (shared between threads)
+     */
+    inline static std::atomic<size_t> OrderCount = 0;
+
+    /**
+     * @brief Method which parses every row of reader into map of Order objects (in batches),
+     *        quantity of row is added to order of its EAN 13
+     *
+     * @exception RowException reading error with row number (beyond error budget)
+     *
+     * @param[in] reader - opened file reading handler
+     * @param[out] orders - hash map to insert Order object into
+     * @param[in, out] report - report of skipped rows
+     */
+    static void parseRows(IFileReader& reader, EanMap<Order>& orders, RowErrorReport& report) noexcept(false);
+    /**
+     * @brief Method which adds partial map of orders to another one (quantities of the same EAN 13 are summed up)
+     *
+     * @param[in, out] orders - map to merge into
+     * @param[in, out] other - partial map, left empty
      */
-    inline static size_t OrderCount = 0;
+    static void mergeOrders(EanMap<Order>& orders, EanMap<Order>& other);
 };
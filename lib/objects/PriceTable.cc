@@ -0,0 +1,53 @@
+#include "PriceTable.h"
+
+void PriceTable::build(const Items& items, const Discounts* discounts)
+{
+    this->clear();
+    mPrices.reserve(items.getNumOfItems());
+
+    items.forEachItem([&](uint64_t key, const Item& item)
+    {
+        const Discount* discount = (discounts) ? discounts->getDiscount(key) : nullptr;
+        PricedItem& pricedItem = mPrices[key];
+
+        pricedItem.name = item.name;
+        pricedItem.taxPercent = item.taxPercent;
+        pricedItem.discountPercent = (discount) ? discount->discountPercent : Percent();
+
+        // caclucate unit price including discount & taxes (rounded once to cents)
+        pricedItem.unitPrice = calculateUnitPrice(item.priceWoTax, item.taxPercent, pricedItem.discountPercent);
+    });
+
+    mItems = &items;
+    mDiscounts = discounts;
+    mItemsGeneration = items.getGeneration();
+    mDiscountsGeneration = (discounts) ? discounts->getGeneration() : 0;
+}
+
+bool PriceTable::isBuiltFrom(const Items& items, const Discounts* discounts) const
+{
+    if (mItems != &items || mDiscounts != discounts)
+    {
+        return false;
+    }
+    return mItemsGeneration == items.getGeneration() && (!discounts || mDiscountsGeneration == discounts->getGeneration());
+}
+
+void PriceTable::clear()
+{
+    mPrices.clear();
+    mItems = nullptr;
+    mDiscounts = nullptr;
+    mItemsGeneration = 0;
+    mDiscountsGeneration = 0;
+}
+
+const PricedItem* PriceTable::find(uint64_t key) const
+{
+    return mPrices.find(key);
+}
+
+size_t PriceTable::size() const
+{
+    return mPrices.size();
+}
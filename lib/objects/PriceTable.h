@@ -0,0 +1,101 @@
+/**
+ * @file PriceTable.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief PricedItem structure & PriceTable class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "EanMap.h"
+#include "FixedPoint.h"
+#include "Items.h"
+#include "Discounts.h"
+
+/**
+ * @brief Item joined with its discount, aligned so it never straddles cache line
+ */
+struct alignas(32) PricedItem
+{
+    /**
+     * @brief item name (owned by Items collection)
+     */
+    std::string_view name;
+    /**
+     * @brief unit price including taxes & discount
+     */
+    Money unitPrice;
+    /**
+     * @brief tax percent of item
+     */
+    Percent taxPercent;
+    /**
+     * @brief discount percent of item (0 if there is no discount)
+     */
+    Percent discountPercent;
+};
+
+static_assert(sizeof(PricedItem) == 32, "Priced item shall fill half of cache line");
+
+/**
+ * @brief Effective prices of items, built once after items & discounts are loaded.
+ *        Pricing an order line takes single lookup instead of item & discount lookups with price calculation.
+ *        Table refers to item names, so it shall be rebuilt whenever items or discounts are reloaded
+ *        (see isBuiltFrom, which compares generations of both).
+ */
+class PriceTable
+{
+public:
+    /**
+     * @brief Method which joins every item with its discount & calculates unit price
+     *
+     * @param[in] items - loaded items
+     * @param[in] discounts - loaded discounts (optional/nullable)
+     */
+    void build(const Items& items, const Discounts* discounts);
+    /**
+     * @brief Check is table built from current generation of items & discounts
+     *
+     * @param[in] items - loaded items
+     * @param[in] discounts - loaded discounts (optional/nullable)
+     * @return true - table is up to date
+     * @return false - table shall be rebuilt
+     */
+    bool isBuiltFrom(const Items& items, const Discounts* discounts) const;
+    /**
+     * @brief Method which drops every priced item
+     */
+    void clear();
+
+    /**
+     * @brief Get the PricedItem object
+     *
+     * @param[in] key - EAN 13 ID
+     * @return const PricedItem* - pointer to priced item if found it or NULL if not
+     */
+    const PricedItem* find(uint64_t key) const;
+    /**
+     * @brief Get the number of priced items
+     */
+    size_t size() const;
+private:
+    /**
+     * @brief Hash map of PricedItem objects
+     */
+    EanMap<PricedItem> mPrices;
+    /**
+     * @brief inputs of table & their generations at the time of building
+     */
+    const Items* mItems = nullptr;
+    const Discounts* mDiscounts = nullptr;
+    size_t mItemsGeneration = 0;
+    size_t mDiscountsGeneration = 0;
+};
@@ -0,0 +1,222 @@
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__GNUC__)
+#define PRICING_KERNEL_AVX
+#include <immintrin.h>
+#endif
+
+#include <atomic>
+
+#include "PricingKernel.h"
+#include "FixedPoint.h"
+
+/**
+ * @brief unit prices & quantities below 2^30 minor units are priced by vector lanes,
+ *        so every intermediate value stays below 2^52 (exact within double)
+ */
+#define PRICING_EXACT_BITS 30
+/**
+ * @brief bits of 2^52 as double, integer below 2^52 ORed into its mantissa gives 2^52 + integer
+ */
+#define PRICING_MAGIC_BITS 0x4330000000000000LL
+
+/**
+ * @brief Pricing function (see PricingKernel::priceLines)
+ */
+using PriceFunction = int64_t (*)(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count);
+
+/**
+ * @brief Prices lines one by one with calculatePrice (reference implementation)
+ *
+ * @param[in] unitPrices - unit prices of lines
+ * @param[in] quantities - quantities of lines
+ * @param[out] finalPrices - final prices of lines
+ * @param[in] count - number of lines
+ * @return int64_t - sum of final prices
+ */
+static int64_t priceLinesScalar(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count);
+#ifdef PRICING_KERNEL_AVX
+/**
+ * @brief Prices lines with AVX2 (4 lines at once)
+ */
+static int64_t priceLinesAvx2(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count);
+/**
+ * @brief Prices lines with AVX-512 (8 lines at once)
+ */
+static int64_t priceLinesAvx512(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count);
+#endif
+/**
+ * @brief Detects best instruction set supported by CPU
+ *
+ * @return PricingKernel::Isa - best instruction set
+ */
+static PricingKernel::Isa detectIsa();
+/**
+ * @brief Get the pricing function of instruction set
+ *
+ * @param[in] isa - instruction set
+ * @return PriceFunction - pricing function
+ */
+static PriceFunction selectPrice(PricingKernel::Isa isa);
+
+/**
+ * @brief instruction set in use, single atomic so pricing threads never see half of setIsa
+ */
+static std::atomic<PricingKernel::Isa> sIsa = detectIsa();
+
+int64_t PricingKernel::priceLines(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count)
+{
+    return selectPrice(sIsa.load(std::memory_order_relaxed))(unitPrices, quantities, finalPrices, count);
+}
+
+PricingKernel::Isa PricingKernel::getIsa()
+{
+    return sIsa.load(std::memory_order_relaxed);
+}
+
+void PricingKernel::setIsa(Isa isa)
+{
+    const Isa best = detectIsa();
+    sIsa.store((static_cast<int>(isa) > static_cast<int>(best)) ? best : isa, std::memory_order_relaxed);
+}
+
+static int64_t priceLinesScalar(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count)
+{
+    int64_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        finalPrices[i] = calculatePrice(Money::fromMinorUnits(unitPrices[i]), Quantity::fromMinorUnits(quantities[i])).getMinorUnits();
+        total += finalPrices[i];
+    }
+    return total;
+}
+
+#ifdef PRICING_KERNEL_AVX
+/*
+ * Both vector implementations split quantity into whole units & fraction (quantity = whole * Scale + fraction), so
+ * unitPrice * quantity / Scale rounded half up = unitPrice * whole + floor((unitPrice * fraction + Scale / 2) / Scale).
+ * Operands are below 2^30, so products are below 2^51 & floor of quotient is exact: distance of non-integer quotient
+ * from the nearest integer (at least 1 / Scale) is far bigger than rounding error of division.
+ */
+
+__attribute__((target("avx2")))
+static int64_t priceLinesAvx2(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count)
+{
+    const __m256i outOfRange = _mm256_set1_epi64x(~((1LL << PRICING_EXACT_BITS) - 1));
+    const __m256i magic = _mm256_set1_epi64x(PRICING_MAGIC_BITS);
+    const __m256d magicDouble = _mm256_castsi256_pd(magic);
+    const __m256d scale = _mm256_set1_pd(static_cast<double>(Quantity::Scale));
+    const __m256d half = _mm256_set1_pd(static_cast<double>(Quantity::Scale / 2));
+    __m256i sum = _mm256_setzero_si256();
+    int64_t total = 0;
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256i unitPrice = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(unitPrices + i));
+        const __m256i quantity = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(quantities + i));
+
+        // negative or too big operand (sign bit is set as well) is priced by reference
+        if (!_mm256_testz_si256(_mm256_or_si256(unitPrice, quantity), outOfRange))
+        {
+            total += priceLinesScalar(unitPrices + i, quantities + i, finalPrices + i, 4);
+            continue;
+        }
+
+        // integers into doubles: 2^52 + integer minus 2^52
+        const __m256d u = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(unitPrice, magic)), magicDouble);
+        const __m256d q = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(quantity, magic)), magicDouble);
+
+        // price of whole units + rounded price of fraction
+        const __m256d whole = _mm256_floor_pd(_mm256_div_pd(q, scale));
+        const __m256d fraction = _mm256_sub_pd(q, _mm256_mul_pd(whole, scale));
+        const __m256d rounded = _mm256_floor_pd(_mm256_div_pd(_mm256_add_pd(_mm256_mul_pd(u, fraction), half), scale));
+        const __m256d price = _mm256_add_pd(_mm256_mul_pd(u, whole), rounded);
+
+        // doubles into integers the opposite way
+        const __m256i finalPrice = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(price, magicDouble)), magic);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(finalPrices + i), finalPrice);
+        sum = _mm256_add_epi64(sum, finalPrice);
+    }
+
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), sum);
+    total += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    return total + priceLinesScalar(unitPrices + i, quantities + i, finalPrices + i, count - i);
+}
+
+__attribute__((target("avx512f")))
+static int64_t priceLinesAvx512(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count)
+{
+    const __m512i outOfRange = _mm512_set1_epi64(~((1LL << PRICING_EXACT_BITS) - 1));
+    const __m512i magic = _mm512_set1_epi64(PRICING_MAGIC_BITS);
+    const __m512d magicDouble = _mm512_castsi512_pd(magic);
+    const __m512d scale = _mm512_set1_pd(static_cast<double>(Quantity::Scale));
+    const __m512d half = _mm512_set1_pd(static_cast<double>(Quantity::Scale / 2));
+    __m512i sum = _mm512_setzero_si512();
+    int64_t total = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m512i unitPrice = _mm512_loadu_si512(unitPrices + i);
+        const __m512i quantity = _mm512_loadu_si512(quantities + i);
+
+        // negative or too big operand (sign bit is set as well) is priced by reference
+        if (_mm512_test_epi64_mask(_mm512_or_si512(unitPrice, quantity), outOfRange))
+        {
+            total += priceLinesScalar(unitPrices + i, quantities + i, finalPrices + i, 8);
+            continue;
+        }
+
+        // integers into doubles: 2^52 + integer minus 2^52
+        const __m512d u = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(unitPrice, magic)), magicDouble);
+        const __m512d q = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(quantity, magic)), magicDouble);
+
+        // price of whole units + rounded price of fraction (zero masked rounding of every lane, unmasked one reads undefined source)
+        const __m512d whole = _mm512_maskz_roundscale_pd(0xFF, _mm512_div_pd(q, scale), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        const __m512d fraction = _mm512_sub_pd(q, _mm512_mul_pd(whole, scale));
+        const __m512d rounded = _mm512_maskz_roundscale_pd(0xFF, _mm512_div_pd(_mm512_add_pd(_mm512_mul_pd(u, fraction), half), scale),
+                                                           _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        const __m512d price = _mm512_add_pd(_mm512_mul_pd(u, whole), rounded);
+
+        // doubles into integers the opposite way
+        const __m512i finalPrice = _mm512_sub_epi64(_mm512_castpd_si512(_mm512_add_pd(price, magicDouble)), magic);
+        _mm512_storeu_si512(finalPrices + i, finalPrice);
+        sum = _mm512_add_epi64(sum, finalPrice);
+    }
+
+    alignas(64) int64_t lanes[8];
+    _mm512_store_si512(lanes, sum);
+    total += lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    return total + priceLinesScalar(unitPrices + i, quantities + i, finalPrices + i, count - i);
+}
+#endif
+
+static PricingKernel::Isa detectIsa()
+{
+#ifdef PRICING_KERNEL_AVX
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return PricingKernel::Isa::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return PricingKernel::Isa::Avx2;
+    }
+#endif
+    return PricingKernel::Isa::Scalar;
+}
+
+static PriceFunction selectPrice(PricingKernel::Isa isa)
+{
+    switch (isa)
+    {
+#ifdef PRICING_KERNEL_AVX
+    case PricingKernel::Isa::Avx512:
+        return priceLinesAvx512;
+    case PricingKernel::Isa::Avx2:
+        return priceLinesAvx2;
+#endif
+    default:
+        return priceLinesScalar;
+    }
+}
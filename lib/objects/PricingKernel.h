@@ -0,0 +1,115 @@
+/**
+ * @file PricingKernel.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief PricingKernel class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "FixedPoint.h"
+
+/**
+ * @brief number of lines copied into columns of pricing kernel at once (columns live on stack)
+ */
+#define PRICING_BLOCK_LEN 256
+
+/**
+ * @brief Vectorized pricing of order lines kept in columns (struct of arrays).
+ *        Final price of every line is calculatePrice(unitPrice, quantity) & total is their sum.
+ *        AVX2 (4 lines) or AVX-512 (8 lines) implementation is chosen at runtime, scalar one is the reference.
+ *        Vector lanes calculate with doubles which hold every intermediate value exactly, so results are
+ *        bit-identical to the reference: lines whose unit price or quantity is negative or not below
+ *        2^30 minor units fall back to the reference. Total is sum of integers, so it doesn't depend
+ *        on number of lanes or order of summation.
+ */
+class PricingKernel
+{
+public:
+    /**
+     * @brief Instruction set used for pricing
+     */
+    enum class Isa
+    {
+        Scalar,
+        Avx2,
+        Avx512
+    };
+
+    /**
+     * @brief Calculates final prices of lines
+     *
+     * @param[in] unitPrices - unit prices of lines (Money minor units)
+     * @param[in] quantities - quantities of lines (Quantity minor units)
+     * @param[out] finalPrices - final prices of lines (Money minor units)
+     * @param[in] count - number of lines
+     * @return int64_t - sum of final prices (Money minor units)
+     */
+    static int64_t priceLines(const int64_t* unitPrices, const int64_t* quantities, int64_t* finalPrices, size_t count);
+    /**
+     * @brief Calculates final prices of lines kept as structures (array of structures), see priceLines.
+     *        Unit prices & quantities are copied into columns on stack in blocks of PRICING_BLOCK_LEN lines
+     *        & final prices are copied back, so cost of pricing includes these copies.
+     *
+     * @tparam Line - line structure
+     * @tparam GetOrder - function which gives ProcessedOrder (unitPrice, quantity & finalPrice) of line
+     * @param[in, out] lines - first line
+     * @param[in] count - number of lines
+     * @param[in] getOrder - processed order of line
+     * @return int64_t - sum of final prices (Money minor units)
+     */
+    template <typename Line, typename GetOrder>
+    static int64_t priceOrders(Line* lines, size_t count, GetOrder getOrder);
+
+    /**
+     * @brief Get the instruction set chosen for this CPU
+     *
+     * @return Isa - used instruction set
+     */
+    static Isa getIsa();
+    /**
+     * @brief Force instruction set (falls back to best supported one if CPU lacks it).
+     *        Intended for tests & benchmarks, calls of priceLines running meanwhile use either the old or the new one.
+     *
+     * @param[in] isa - instruction set to use
+     */
+    static void setIsa(Isa isa);
+};
+
+template <typename Line, typename GetOrder>
+int64_t PricingKernel::priceOrders(Line* lines, size_t count, GetOrder getOrder)
+{
+    int64_t unitPrices[PRICING_BLOCK_LEN];
+    int64_t quantities[PRICING_BLOCK_LEN];
+    int64_t finalPrices[PRICING_BLOCK_LEN];
+    int64_t total = 0;
+
+    for (size_t block = 0; block < count; block += PRICING_BLOCK_LEN)
+    {
+        const size_t blockLen = std::min<size_t>(PRICING_BLOCK_LEN, count - block);
+
+        // lines into columns
+        for (size_t i = 0; i < blockLen; i++)
+        {
+            unitPrices[i] = getOrder(lines[block + i]).unitPrice.getMinorUnits();
+            quantities[i] = getOrder(lines[block + i]).quantity.getMinorUnits();
+        }
+
+        total += priceLines(unitPrices, quantities, finalPrices, blockLen);
+
+        // final prices back into lines
+        for (size_t i = 0; i < blockLen; i++)
+        {
+            getOrder(lines[block + i]).finalPrice = Money::fromMinorUnits(finalPrices[i]);
+        }
+    }
+    return total;
+}
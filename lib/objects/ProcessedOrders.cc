@@ -1,42 +1,27 @@
-#include <iomanip>
+#include <algorithm>
+#include <vector>
 #include <climits>
 #include <cstdint>
-#include <cmath>
 
 #include "ProcessedOrders.h"
+#include "CsvLoader.h"
+#include "PricingKernel.h"
+#include "bill/TextBillSink.h"
 
 #define PROC_ORDERS_NUM_OF_COLS 6
-#define DECIMAL_DIGITS 3 /* i.e. ".00" */
-#define COLS_MIN_DISTANCE 5
-#define PROD_NAME_MAX_LEN 20
-#define PERCENT_MAX_LEN 6
-#define PRICE_MAX_LEN 9
-#define AMOUNT_MAX_LEN 9
-
-/**
- * @brief Function which generates string with specified amount of spaces and vertial bar (optionally)
- *
- * @param[in] amount - amount of spaces
- * @param[in] veritcal_bar_postition - pointer to position of vertical bar within string (optional/nullable)
- * @return std::string - generated string
- */
-static std::string generateWhiteSpaces(size_t amount, size_t* veritcal_bar_postition = nullptr);
 /**
- * @brief Counts number of digits within particular number
- *
- * @param[in] number - digit to be compared
- * @return size_t - number of digits
+ * @brief number of lines priced by single task of scheduler
  */
-static size_t count_digit(int number);
+#define PRICE_RANGE_LEN (16 * 1024)
+
 /**
- * @brief Rounds decimal
+ * @brief Function which gives processed order of single item to bill sink
  *
- * @param[in] number - number to be converted
- * @param[in] precision - precision of number
- *
- * @return rounded decimal
+ * @param[in] line - EAN 13, item name & processed order
+ * @return BillLine - line of bill
  */
-static double round_decimal(double number, size_t precision);
+template <typename Line>
+static BillLine toBillLine(const Line& line);
 
 bool ProcessedOrder::operator==(const ProcessedOrder& other) const
 {
@@ -64,194 +49,359 @@ bool ProcessedOrder::operator==(const ProcessedOrder& other) const
 }
 
 ProcessedOrders::ProcessedOrders() :
-    mTotal{0},
+    mTotal{},
     mOrderNum{0}
 {
 
 }
 
-/**
-* Name            Tax   Disc.  U.price  Quant.  Price
-* ---------------------------------------------------
-* Fairy Dust	  8.80 	 0.00     4.99   3.00   14,97
-* Helping Hand	 12.00 	30.00   699.99   1.00  489.99
-* Freezing Coat  12.00 	15.00   124.99   1.00   87.49
-* ---------------------------------------------------
-* Total                                        592.45
-**/
-void ProcessedOrders::operator>>(std::ofstream& writer) noexcept(false)
+void ProcessedOrders::operator>>(std::ostream& writer) noexcept(false)
 {
-    size_t whitespaces;
-    size_t veritcal_bar_pos;
-    std::string name;
-    double round_decimal_num;
+    this->writeBill(writer, TextBillSink());
+}
+
+void ProcessedOrders::writeBill(std::ostream& writer, const IBillSink& sink) noexcept(false)
+{
+    const std::string_view bill = this->formatBill(sink);
+    writer.write(bill.data(), static_cast<std::streamsize>(bill.length()));
+}
+
+std::string_view ProcessedOrders::formatBill() noexcept(false)
+{
+    return this->formatBill(TextBillSink());
+}
 
-    if (mProcessedOrders.empty())
+std::string_view ProcessedOrders::formatBill(const IBillSink& sink) noexcept(false)
+{
+    if (mLines.empty())
     {
         throw std::runtime_error("Didn't processed any order yet.");
     }
 
-    // set fixed decimal precision print
-    writer << std::fixed << std::setprecision(2);
+    // sort view of lines by item name, lines of items with the same name stay in EAN 13 order
+    // (std::stable_sort would take its buffer from global allocator)
+    mBill.clear();
+    mBill.reserve(mLines.size());
+    for (const Line& line : mLines)
+    {
+        mBill.push_back(&line);
+    }
+    std::sort(mBill.begin(), mBill.end(), [](const Line* a, const Line* b)
+    {
+        return (a->name != b->name) ? a->name < b->name : a->ean13 < b->ean13;
+    });
 
-    // enter table header
-    writer << "Order #" << mOrderNum << std::endl;
-    writer << "------------------------------------------------------------------------------------" << std::endl;
-    writer << "Name                  |     Tax  |   Disc.  |    U.price  |     Quant.  |      Price" << std::endl;
-    writer << "------------------------------------------------------------------------------------" << std::endl;
+    // whole bill is rendered into single buffer within arena
+    const BillSummary summary{mOrderNum, mBill.size(), mTotal};
+    size_t capacity = sink.getMaxLength(summary);
+    for (const Line* line : mBill)
+    {
+        capacity += sink.getMaxLength(toBillLine(*line));
+    }
+    char* const begin = static_cast<char*>(mArena.allocate(capacity, alignof(uint64_t)));
 
-    for (auto it = mProcessedOrders.cbegin(); it != mProcessedOrders.cend(); it++)
+    char* out = sink.writeHeader(begin, summary);
+    for (const Line* line : mBill)
     {
-        // assign name
-        name = it->first;
-        if (name.length() > PROD_NAME_MAX_LEN)
-        {
-            // if name has length bigger than 20 make it shorter
-            // i.e. "Very Long Name Of Prodcut" => "Very Long Name Of..."
-            name = name.substr(0, PROD_NAME_MAX_LEN - 3) + "...";
-        }
-        // append item name to discount
-        writer << name;
-
-        veritcal_bar_pos = PROD_NAME_MAX_LEN - name.length();
-        round_decimal_num = round_decimal(it->second.taxPercent, 2);
-        whitespaces = veritcal_bar_pos + COLS_MIN_DISTANCE + PERCENT_MAX_LEN - count_digit((int)round_decimal_num) - DECIMAL_DIGITS;
-        veritcal_bar_pos += 2;
-        // append item tax percent
-        writer << generateWhiteSpaces(whitespaces, &veritcal_bar_pos) << round_decimal_num;
-
-        veritcal_bar_pos = 2;
-        round_decimal_num = round_decimal(it->second.discountPercent, 2);
-        whitespaces = COLS_MIN_DISTANCE + PERCENT_MAX_LEN - count_digit((int)round_decimal_num) - DECIMAL_DIGITS;
-        // append item discount percent
-        writer << generateWhiteSpaces(whitespaces, &veritcal_bar_pos) << round_decimal_num;
-
-        round_decimal_num = round_decimal(it->second.unitPrice, 2);
-        whitespaces = COLS_MIN_DISTANCE + PRICE_MAX_LEN - count_digit((int)round_decimal_num) - DECIMAL_DIGITS;
-        // append item price wo discount
-        writer << generateWhiteSpaces(whitespaces, &veritcal_bar_pos) << round_decimal_num;
-
-        round_decimal_num = round_decimal(it->second.quantity, 2);
-        whitespaces = COLS_MIN_DISTANCE + AMOUNT_MAX_LEN - count_digit((int)round_decimal_num) - DECIMAL_DIGITS;
-        // append item quantity
-        writer << generateWhiteSpaces(whitespaces, &veritcal_bar_pos) << round_decimal_num;
-
-        round_decimal_num = round_decimal(it->second.finalPrice, 2);
-        whitespaces = COLS_MIN_DISTANCE + PRICE_MAX_LEN - count_digit((int)round_decimal_num) - DECIMAL_DIGITS;
-        // append item final price
-        writer << generateWhiteSpaces(whitespaces, &veritcal_bar_pos) << round_decimal_num << std::endl;
+        out = sink.writeLine(out, summary, toBillLine(*line));
     }
+    out = sink.writeFooter(out, summary);
 
-    writer << "------------------------------------------------------------------------------------" << std::endl;
-    whitespaces = 70 + PRICE_MAX_LEN - count_digit(mTotal) - DECIMAL_DIGITS;
-    // write total price
-    writer << "Total" << generateWhiteSpaces(whitespaces) << mTotal;
+    return std::string_view(begin, static_cast<size_t>(out - begin));
 }
 
 void ProcessedOrders::processOrder(const Orders* initialOrders, const  Items* items, const  Discounts* discounts) noexcept(false)
 {
-    const Item* currentItem;
-    const Discount* currentDiscount;
-    ProcessedOrder* procOrder;
-
     if (!initialOrders || !items)
     {
         throw std::runtime_error("orders & items can't be NULL.");
     }
 
-    mProcessedOrders.clear();
-    mTotal = 0;
+    this->prepare(items, discounts);
+    this->makeLines(*initialOrders, mPriceTable);
+}
 
-    for (auto it = initialOrders->mOrders.begin(); it != initialOrders->mOrders.end(); it++)
+void ProcessedOrders::processOrder(const Orders& initialOrders, const PriceTable& prices) noexcept(false)
+{
+    this->clearLines();
+    this->makeLines(initialOrders, prices);
+}
+
+void ProcessedOrders::processOrder(IFileReader& reader, const Items* items, const Discounts* discounts) noexcept(false)
+{
+    if (!items)
     {
-        // get current item
-        try
-        {
-            currentItem = &items->mItems.at(it->first);
-        }
-        catch (...)
-        {
-            throw std::runtime_error("can't find order for item " + std::to_string(it->first) + " within items.");
-        }
+        throw std::runtime_error("items can't be NULL.");
+    }
 
-        // get discount
-        try
-        {
-            currentDiscount = (discounts) ? &discounts->mDiscounts.at(it->first) : nullptr;
-        }
-        catch (...)
+    this->prepare(items, discounts);
+    this->readRows(reader, mPriceTable);
+
+    // numbered the same way as deserialized Orders
+    mOrderNum = Orders::reserveOrderNums(1);
+}
+
+void ProcessedOrders::processOrder(IFileReader& reader, const PriceTable& prices, size_t orderNum) noexcept(false)
+{
+    this->clearLines();
+    this->readRows(reader, prices);
+    mOrderNum = orderNum;
+}
+
+void ProcessedOrders::processOrder(const std::string& filename, const PriceTable& prices, size_t orderNum, WorkStealingScheduler& scheduler) noexcept(false)
+{
+    this->clearLines();
+    mErrorReport.clear();
+
+    // chunks of order are parsed into partial maps & summed up
+    EanMap<Order> orders(&mArena);
+    mNumOfRows = loadRowsStealing(filename, scheduler, orders, mErrorReport, &Orders::parseRows, &Orders::mergeOrders);
+
+    this->priceOrders(orders, prices, scheduler);
+    mOrderNum = orderNum;
+}
+
+size_t ProcessedOrders::getOrderNum() const
+{
+    return mOrderNum;
+}
+
+Money ProcessedOrders::getTotal() const
+{
+    return mTotal;
+}
+
+size_t ProcessedOrders::getNumOfRows() const
+{
+    return mNumOfRows;
+}
+
+void ProcessedOrders::setErrorBudget(size_t budget)
+{
+    mErrorReport.setBudget(budget);
+}
+
+const RowErrorReport& ProcessedOrders::getErrorReport() const
+{
+    return mErrorReport;
+}
+
+const Arena& ProcessedOrders::getArena() const
+{
+    return mArena;
+}
+
+const ProcessedOrder* ProcessedOrders::getProcessedOrder(uint64_t ean13) const
+{
+    const auto it = std::lower_bound(mLines.begin(), mLines.end(), ean13, [](const Line& line, uint64_t key) { return line.ean13 < key; });
+    return (it != mLines.end() && it->ean13 == ean13) ? &it->order : nullptr;
+}
+
+const ProcessedOrder* ProcessedOrders::getProcessedOrder(std::string_view itemName) const
+{
+    const auto it = std::find_if(mLines.begin(), mLines.end(), [itemName](const Line& line) { return line.name == itemName; });
+    return (it != mLines.end()) ? &it->order : nullptr;
+}
+
+void ProcessedOrders::clearLines()
+{
+    // empty lines & bill view, then reuse their memory
+    std::pmr::vector<Line>(&mArena).swap(mLines);
+    std::pmr::vector<const Line*>(&mArena).swap(mBill);
+    mLineIndices.clear();
+    mArena.reset();
+    mTotal = Money();
+    mNumOfRows = 0;
+}
+
+void ProcessedOrders::prepare(const Items* items, const Discounts* discounts) noexcept(false)
+{
+    this->clearLines();
+
+    // join items with discounts once per load of them
+    if (!mPriceTable.isBuiltFrom(*items, discounts))
+    {
+        mPriceTable.build(*items, discounts);
+    }
+}
+
+void ProcessedOrders::makeLines(const Orders& initialOrders, const PriceTable& prices) noexcept(false)
+{
+    const PricedItem* currentItem;
+    ProcessedOrder* procOrder;
+
+    mLines.reserve(initialOrders.mOrders.size());
+    for (const auto& element : initialOrders.mOrders)
+    {
+        const Order& order = element.second;
+
+        // get current item with its discount (there may be no discount for particular item, which is OK)
+        currentItem = prices.find(element.first);
+        if (!currentItem)
         {
-            // there is no discount for particular item, which is OK
-            currentDiscount = nullptr;
+            throw std::runtime_error("can't find order for item " + std::to_string(element.first) + " within items.");
         }
 
-        // insert map element with key
-        procOrder = &mProcessedOrders.insert(std::make_pair(currentItem->name, ProcessedOrder())).first->second;
+        // append line of item (item name is referred, not copied)
+        mLines.push_back(Line{element.first, currentItem->name, ProcessedOrder()});
+        procOrder = &mLines.back().order;
 
         // get tax percentage from current item
         procOrder->taxPercent = currentItem->taxPercent;
 
-        // get discount percentage from discounts
-        procOrder->discountPercent = (currentDiscount) ? currentDiscount->discountPercent : 0;
+        // get discount percentage from current item
+        procOrder->discountPercent = currentItem->discountPercent;
 
         // get quantity from current order
-        procOrder->quantity = it->second.quantity;
+        procOrder->quantity = order.quantity;
 
-        // caclucate unit price including discount & taxes
-        procOrder->unitPrice = currentItem->priceWoTax * (1.0f + currentItem->taxPercent/100) * (1.0f - procOrder->discountPercent / 100);
+        // get unit price including discount & taxes
+        procOrder->unitPrice = currentItem->unitPrice;
+    }
 
-        // calculate final price
-        procOrder->finalPrice = procOrder->unitPrice * procOrder->quantity;
+    // calculate final prices & total price
+    mTotal = this->priceLines(0, mLines.size());
 
-        // calculate total price
-        mTotal += procOrder->finalPrice;
-    }
-    mOrderNum = initialOrders->mOrderNum;
+    // hash map order is unspecified, lines are kept in EAN 13 order
+    std::sort(mLines.begin(), mLines.end(), [](const Line& a, const Line& b) { return a.ean13 < b.ean13; });
+    mOrderNum = initialOrders.mOrderNum;
 }
 
-size_t ProcessedOrders::getOrderNum() const
+void ProcessedOrders::readRows(IFileReader& reader, const PriceTable& prices) noexcept(false)
 {
-    return mOrderNum;
+    const PricedItem* currentItem;
+    std::vector<RowError> errors;
+    size_t decoded;
+
+    mErrorReport.clear();
+
+    // batch buffers & line indices live within arena, their size doesn't depend on number of rows
+    std::pmr::vector<uint64_t> keys(ROW_BATCH_LEN, &mArena);
+    std::pmr::vector<Quantity> quantities(ROW_BATCH_LEN, &mArena);
+
+    do
+    {
+        // decode batch of rows into columns, malformed rows are recorded (or rejected by error budget)
+        errors.clear();
+        decoded = reader.readBatch<OrdersSchema>(errors, keys, quantities);
+        mErrorReport.add(errors);
+
+        for (size_t i = 0; i < decoded; i++)
+        {
+            size_t& index = mLineIndices[keys[i]];
+            if (index == 0)
+            {
+                // get current item with its discount on the first row of item (there may be no discount, which is OK)
+                currentItem = prices.find(keys[i]);
+                if (!currentItem)
+                {
+                    throw std::runtime_error("can't find order for item " + std::to_string(keys[i]) + " within items.");
+                }
+
+                // append line of item (item name is referred, not copied)
+                mLines.push_back(Line{keys[i], currentItem->name, ProcessedOrder()});
+                mLines.back().order.taxPercent = currentItem->taxPercent;
+                mLines.back().order.discountPercent = currentItem->discountPercent;
+                mLines.back().order.unitPrice = currentItem->unitPrice;
+                index = mLines.size();
+            }
+
+            // add quantity of row to line
+            mLines[index - 1].order.quantity += quantities[i];
+        }
+    } while (decoded == ROW_BATCH_LEN);
+
+    // price is rounded once per line, so lines are priced when their quantity is complete
+    mTotal = this->priceLines(0, mLines.size());
+
+    mNumOfRows = reader.getRowNum();
+
+    // lines are kept in EAN 13 order, indices aren't needed any more
+    std::sort(mLines.begin(), mLines.end(), [](const Line& a, const Line& b) { return a.ean13 < b.ean13; });
+    mLineIndices.clear();
 }
 
-const ProcessedOrder* ProcessedOrders::getProcessedOrder(std::string itemName) const
+void ProcessedOrders::priceOrders(const EanMap<Order>& orders, const PriceTable& prices, WorkStealingScheduler& scheduler) noexcept(false)
 {
-    try
+    // lines in EAN 13 order
+    mLines.reserve(orders.size());
+    for (const auto& element : orders)
     {
-        return &mProcessedOrders.at(itemName);
+        mLines.push_back(Line{element.first, std::string_view(), ProcessedOrder()});
+        mLines.back().order.quantity = element.second.quantity;
     }
-    catch (...)
+    std::sort(mLines.begin(), mLines.end(), [](const Line& a, const Line& b) { return a.ean13 < b.ean13; });
+
+    // every range of lines is priced by its own task, the first missing item & subtotal of range are remembered
+    const size_t numOfRanges = (mLines.size() + PRICE_RANGE_LEN - 1) / PRICE_RANGE_LEN;
+    std::pmr::vector<uint64_t> missing(numOfRanges, EAN_MAP_EMPTY_KEY, &mArena);
+    std::pmr::vector<Money> subtotals(numOfRanges, &mArena);
+    const auto priceRange = [this, &prices, &missing, &subtotals](size_t range)
     {
-        return nullptr;
-    }
-}
+        const size_t begin = range * PRICE_RANGE_LEN;
+        const size_t end = std::min(mLines.size(), begin + PRICE_RANGE_LEN);
+        for (size_t i = begin; i < end; i++)
+        {
+            Line& line = mLines[i];
+            const PricedItem* currentItem = prices.find(line.ean13);
+            if (!currentItem)
+            {
+                missing[range] = std::min(missing[range], line.ean13);
+                continue;
+            }
+
+            line.name = currentItem->name;
+            line.order.taxPercent = currentItem->taxPercent;
+            line.order.discountPercent = currentItem->discountPercent;
+            line.order.unitPrice = currentItem->unitPrice;
+        }
+        subtotals[range] = this->priceLines(begin, end);
+    };
 
-static std::string generateWhiteSpaces(size_t amount, size_t* veritcal_bar_postition)
-{
-    std::string ret = "";
-    for (size_t i = 0; i < amount; i++)
+    if (numOfRanges > 1)
     {
-        if (veritcal_bar_postition && i == *veritcal_bar_postition)
+        TaskGroup group;
+        for (size_t range = 0; range < numOfRanges; range++)
         {
-            ret += "|";
-            continue;
+            scheduler.submit(group, [&priceRange, range]() { priceRange(range); });
         }
-        ret += " ";
+        scheduler.wait(group);
+    }
+    else if (numOfRanges == 1)
+    {
+        priceRange(0);
     }
-    return ret;
-}
 
-static size_t count_digit(int number)
-{
-    if (number)
+    // the lowest missing EAN 13 is reported, regardless of ranges
+    const uint64_t firstMissing = (numOfRanges > 0) ? *std::min_element(missing.begin(), missing.end()) : EAN_MAP_EMPTY_KEY;
+    if (firstMissing != EAN_MAP_EMPTY_KEY)
+    {
+        throw std::runtime_error("can't find order for item " + std::to_string(firstMissing) + " within items.");
+    }
+
+    // sum of integers doesn't depend on ranges, total is the same as the one of sequential processing
+    for (const Money subtotal : subtotals)
     {
-        return size_t(std::log10(number) + 1);
+        mTotal += subtotal;
     }
-    return 1;
 }
 
-static double round_decimal(double number, size_t precision)
+Money ProcessedOrders::priceLines(size_t begin, size_t end)
+{
+    // lines are priced in place through columns of pricing kernel
+    return Money::fromMinorUnits(PricingKernel::priceOrders(mLines.data() + begin, end - begin, [](Line& line) -> ProcessedOrder& { return line.order; }));
+}
+
+template <typename Line>
+static BillLine toBillLine(const Line& line)
 {
-    double factor = std::pow(10.0, precision);
-    return std::round(number * factor) / factor;
+    BillLine billLine;
+    billLine.ean13 = line.ean13;
+    billLine.name = line.name;
+    billLine.taxPercent = line.order.taxPercent;
+    billLine.discountPercent = line.order.discountPercent;
+    billLine.unitPrice = line.order.unitPrice;
+    billLine.quantity = line.order.quantity;
+    billLine.finalPrice = line.order.finalPrice;
+    return billLine;
 }
@@ -11,14 +11,22 @@
 
 #pragma once
 
-#include <map>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <fstream>
+#include <vector>
 
 #include "Orders.h"
 #include "Discounts.h"
 #include "Items.h"
+#include "FixedPoint.h"
+#include "PriceTable.h"
+#include "concurrency/WorkStealingScheduler.h"
+#include "bill/IBillSink.h"
+#include "file_reader/IFileReader.h"
+#include "file_reader/RowErrorReport.h"
+#include "memory/Arena.h"
 
 /**
  * @brief ProcessedOrder object structure
@@ -28,23 +36,23 @@ struct ProcessedOrder
     /**
      * @brief processed order tax percent 
      */
-    float taxPercent;
+    Percent taxPercent;
     /**
      * @brief processed order discount percent 
      */
-    float discountPercent;
+    Percent discountPercent;
     /**
      * @brief processed order quantity 
      */
-    float quantity;
+    Quantity quantity;
     /**
      * @brief processed order price for unit
      */
-    double unitPrice;
+    Money unitPrice;
     /**
      * @brief processed order final price (including quantity) 
      */
-    double finalPrice;
+    Money finalPrice;
 
     /**
      * @brief Overloaded perator.
@@ -63,7 +71,10 @@ struct ProcessedOrder
 
 /**
  * @brief Order objects collection class
- *        handles deserialization of order objects in combination with ofstream (standard library)
+ *        handles deserialization of order objects in combination with ofstream (standard library) or bill sinks.
+ *        Processed orders refer to item names owned by Items, so Items shall outlive them (or be processed again after reload).
+ *        Lines are kept in EAN 13 order, bill sorts them by item name only while it is written.
+ *        Lines & bill view are kept within arena which is reset by every processed order.
  */
 class ProcessedOrders
 {
@@ -81,9 +92,36 @@ public:
      * @brief Overloaded perator.
      *        Method which handles serialization of processed order objects
      *
+     * @param[in] writer - writing handler (file or string stream)
+     */
+    void operator>>(std::ostream& writer) noexcept(false);
+    /**
+     * @brief Method which writes bill in format of sink (file stream shall be opened with mode of sink)
+     *
+     * @exception std::runtime_error if no order is processed
+     *
      * @param[in] writer - writing handler
+     * @param[in] sink - format of bill
+     */
+    void writeBill(std::ostream& writer, const IBillSink& sink) noexcept(false);
+    /**
+     * @brief Method which renders text bill (sorted by item name) into single buffer within arena,
+     *        so it can be written at once
+     *
+     * @exception std::runtime_error if no order is processed
+     *
+     * @return std::string_view - bill, valid until next processed order
+     */
+    std::string_view formatBill() noexcept(false);
+    /**
+     * @brief Method which renders bill in format of sink (lines sorted by item name) into single buffer within arena
+     *
+     * @exception std::runtime_error if no order is processed
+     *
+     * @param[in] sink - format of bill
+     * @return std::string_view - bill, valid until next processed order
      */
-    void operator>>(std::ofstream& writer) noexcept(false);
+    std::string_view formatBill(const IBillSink& sink) noexcept(false);
     /**
      * @brief Method which process initial Orders and makes final price
      *
@@ -92,6 +130,56 @@ public:
      * @param[in] discounts - discounts (optional/nullable)
      */
     void processOrder(const Orders* initialOrders, const  Items* items, const  Discounts* discounts = nullptr) noexcept(false);
+    /**
+     * @brief Method which process initial Orders against price table shared with other threads (pipeline mode),
+     *        order number is taken from initial Orders
+     *
+     * @exception std::runtime_error if item of order can't be found
+     *
+     * @param[in] initialOrders - initial orders as input
+     * @param[in] prices - unit prices of items with discounts, shall outlive processed orders
+     */
+    void processOrder(const Orders& initialOrders, const PriceTable& prices) noexcept(false);
+    /**
+     * @brief Method which prices order rows as soon as they are read (fused mode), no Orders map is built.
+     *        Rows of the same EAN 13 are aggregated into line of item, lines are priced once their quantity is complete,
+     *        so memory depends on number of distinct items, not on number of rows.
+     *        Result (including order number) is the same as deserialization into Orders followed by processOrder.
+     *
+     * @exception RowException reading error with row number (beyond error budget)
+     * @exception std::runtime_error if item of order can't be found or file is not opened
+     *
+     * @param[in] reader - opened order file reading handler
+     * @param[in] items - items values without discount calculation
+     * @param[in] discounts - discounts (optional/nullable)
+     */
+    void processOrder(IFileReader& reader, const Items* items, const Discounts* discounts = nullptr) noexcept(false);
+    /**
+     * @brief Method which prices order rows as soon as they are read (fused mode) against price table shared
+     *        with other threads (batch mode). Price table is only read, so many ProcessedOrders may use it at once.
+     *
+     * @exception RowException reading error with row number (beyond error budget)
+     * @exception std::runtime_error if item of order can't be found or file is not opened
+     *
+     * @param[in] reader - opened order file reading handler
+     * @param[in] prices - unit prices of items with discounts, shall outlive processed orders
+     * @param[in] orderNum - order number (see Orders::reserveOrderNums)
+     */
+    void processOrder(IFileReader& reader, const PriceTable& prices, size_t orderNum) noexcept(false);
+    /**
+     * @brief Method which processes order file as tasks of scheduler (batch mode with big orders).
+     *        Chunks of file are parsed & ranges of lines are priced by subtasks which idle workers steal,
+     *        result is the same as sequential processing. May be called from task of the same scheduler.
+     *
+     * @exception RowException reading error with row number (beyond error budget)
+     * @exception std::runtime_error if item of order can't be found or file can't be opened
+     *
+     * @param[in] filename - order CSV file
+     * @param[in] prices - unit prices of items with discounts, shall outlive processed orders
+     * @param[in] orderNum - order number (see Orders::reserveOrderNums)
+     * @param[in] scheduler - scheduler of subtasks
+     */
+    void processOrder(const std::string& filename, const PriceTable& prices, size_t orderNum, WorkStealingScheduler& scheduler) noexcept(false);
 
     /**
      * @brief Get the Order Num
@@ -99,26 +187,149 @@ public:
      * @return order num
      */
     size_t getOrderNum() const;
+    /**
+     * @brief Get the total price of processed order
+     *
+     * @return Money - sum of final prices
+     */
+    Money getTotal() const;
+    /**
+     * @brief Get the number of rows read from order file (including skipped ones)
+     *
+     * @return size_t - number of rows (0 if Orders have been processed)
+     */
+    size_t getNumOfRows() const;
 
     /**
-     * @brief Get the ProcessedOrder object from map
+     * @brief Get the ProcessedOrder object of item
      *
-     * @param[in] itemName - name of product (item)
+     * @param[in] ean13 - EAN 13 ID of product (item)
      *
      * @return processed order if exists
      */
-    const ProcessedOrder* getProcessedOrder(std::string itemName) const;
+    const ProcessedOrder* getProcessedOrder(uint64_t ean13) const;
+    /**
+     * @brief Get the ProcessedOrder object by item name (linear search)
+     *
+     * @param[in] itemName - name of product (item)
+     *
+     * @return processed order if exists, the one with the lowest EAN 13 if more items share the name
+     */
+    const ProcessedOrder* getProcessedOrder(std::string_view itemName) const;
+
+    /**
+     * @brief Set the error budget of fused mode, see IObjects::setErrorBudget
+     *
+     * @param[in] budget - maximal number of skipped order rows
+     */
+    void setErrorBudget(size_t budget);
+    /**
+     * @brief Get the error report of the last order processed in fused mode
+     *
+     * @return const RowErrorReport& - skipped order rows
+     */
+    const RowErrorReport& getErrorReport() const;
+
+    /**
+     * @brief Get the arena of processed orders (allocation counters)
+     *
+     * @return const Arena& - arena of lines & bill view
+     */
+    const Arena& getArena() const;
 private:
     /**
-     * @brief Map of ProcessedOrder objects
+     * @brief Processed order of single item
+     */
+    struct Line
+    {
+        /**
+         * @brief EAN 13 ID of item
+         */
+        uint64_t ean13;
+        /**
+         * @brief view of item name within Items string pool
+         */
+        std::string_view name;
+        /**
+         * @brief processed order
+         */
+        ProcessedOrder order;
+    };
+
+    /**
+     * @brief Memory of lines & bill view, reset by every processed order
+     */
+    Arena mArena;
+    /**
+     * @brief Lines sorted by EAN 13 (within arena)
+     */
+    std::pmr::vector<Line> mLines{&mArena};
+    /**
+     * @brief Lines sorted by item name, built while bill is written (within arena)
+     */
+    std::pmr::vector<const Line*> mBill{&mArena};
+    /**
+     * @brief Index of line + 1 per EAN 13, used by fused mode while rows are read (within arena)
+     */
+    EanMap<size_t> mLineIndices{&mArena};
+    /**
+     * @brief skipped rows of order processed in fused mode
      */
-    std::map<std::string, ProcessedOrder> mProcessedOrders;
+    RowErrorReport mErrorReport;
+    /**
+     * @brief unit prices of items with discounts, rebuilt after reload of items or discounts
+     */
+    PriceTable mPriceTable;
     /**
      * @brief total price of orders
      */
-    double mTotal;
+    Money mTotal;
     /**
      * @brief Order Number
      */
     size_t mOrderNum;
+    /**
+     * @brief number of rows read from order file
+     */
+    size_t mNumOfRows = 0;
+
+    /**
+     * @brief Method which empties lines & resets arena
+     */
+    void clearLines();
+    /**
+     * @brief Method which empties lines & rebuilds price table if items or discounts have changed
+     */
+    void prepare(const Items* items, const Discounts* discounts) noexcept(false);
+    /**
+     * @brief Method which makes lines of initial Orders & prices them
+     *
+     * @param[in] initialOrders - initial orders
+     * @param[in] prices - unit prices of items with discounts
+     */
+    void makeLines(const Orders& initialOrders, const PriceTable& prices) noexcept(false);
+    /**
+     * @brief Method which reads every order row into lines & prices them (fused mode)
+     *
+     * @param[in] reader - opened order file reading handler
+     * @param[in] prices - unit prices of items with discounts
+     */
+    void readRows(IFileReader& reader, const PriceTable& prices) noexcept(false);
+    /**
+     * @brief Method which makes lines of summed up orders & prices them in ranges on scheduler
+     *
+     * @param[in] orders - orders of distinct items
+     * @param[in] prices - unit prices of items with discounts
+     * @param[in] scheduler - scheduler of ranges
+     */
+    void priceOrders(const EanMap<Order>& orders, const PriceTable& prices, WorkStealingScheduler& scheduler) noexcept(false);
+    /**
+     * @brief Method which calculates final prices of lines with pricing kernel.
+     *        Lines are copied into columns block by block, so it is safe to price distinct ranges at once.
+     *
+     * @param[in] begin - index of first line
+     * @param[in] end - index behind last line
+     * @return Money - sum of final prices of lines
+     */
+    Money priceLines(size_t begin, size_t end);
 };
@@ -0,0 +1,213 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "Snapshot.h"
+
+#define SNAPSHOT_MAGIC "AOSSNAP"
+#define SNAPSHOT_TMP_EXTENSION ".tmp"
+#define CHECKSUM_OFFSET_BASIS 14695981039346656037ULL
+#define CHECKSUM_PRIME 1099511628211ULL
+
+/**
+ * @brief Reads size & last write time of file
+ *
+ * @param[in] filename - file to check
+ * @param[out] size - size of file in bytes
+ * @param[out] time - last write time of file (clock ticks)
+ * @return true - file exists
+ * @return false - file is missing
+ */
+static bool readFileStamp(const std::string& filename, uint64_t& size, int64_t& time);
+/**
+ * @brief Calculates FNV-1a like checksum, one 8 byte word per step
+ *
+ * @param[in] data - data to check
+ * @param[in] length - data length
+ * @param[in] checksum - checksum of preceding data (CHECKSUM_OFFSET_BASIS for the first one)
+ * @return uint64_t - checksum including data
+ */
+static uint64_t calculateChecksum(const char* data, size_t length, uint64_t checksum);
+
+void Snapshot::write(const std::string& csvFilename, SnapshotType type, const void* records, size_t recordSize, size_t numOfRecords,
+                     std::string_view pool, size_t numOfSkippedRows) noexcept(false)
+{
+    SnapshotHeader header = {};
+    const std::string filename = csvFilename + SNAPSHOT_EXTENSION;
+    const std::string tmpFilename = filename + SNAPSHOT_TMP_EXTENSION;
+    const size_t recordsSize = recordSize * numOfRecords;
+
+    // records keep 8 bytes alignment of each other & of string pool
+    if (recordSize == 0 || recordSize % sizeof(uint64_t))
+    {
+        throw std::invalid_argument("Snapshot record size shall be multiple of 8 bytes");
+    }
+
+    // snapshot remembers which CSV file it belongs to
+    if (!readFileStamp(csvFilename, header.sourceSize, header.sourceTime))
+    {
+        throw std::runtime_error("Can't write snapshot of missing file " + csvFilename);
+    }
+
+    // fill the rest of header
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.type = static_cast<uint32_t>(type);
+    header.recordSize = static_cast<uint32_t>(recordSize);
+    header.numOfSkippedRows = static_cast<uint32_t>(std::min<size_t>(numOfSkippedRows, UINT32_MAX));
+    header.numOfRecords = numOfRecords;
+    header.poolSize = pool.length();
+    header.checksum = calculateChecksum(static_cast<const char*>(records), recordsSize, CHECKSUM_OFFSET_BASIS);
+    header.checksum = calculateChecksum(pool.data(), pool.length(), header.checksum);
+
+    // write temporary file first, so reader never maps half written snapshot
+    std::ofstream writer(tmpFilename, std::ios::binary | std::ios::trunc);
+    writer.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writer.write(static_cast<const char*>(records), recordsSize);
+    writer.write(pool.data(), pool.length());
+    writer.close();
+    if (!writer)
+    {
+        std::remove(tmpFilename.c_str());
+        throw std::runtime_error("Failed to write snapshot " + tmpFilename);
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tmpFilename, filename, error);
+    if (error)
+    {
+        std::remove(tmpFilename.c_str());
+        throw std::runtime_error("Failed to replace snapshot " + filename + ": " + error.message());
+    }
+}
+
+bool Snapshot::open(const std::string& csvFilename, SnapshotType type, size_t recordSize, size_t errorBudget,
+                    SnapshotRecordValidator validateRecord)
+{
+    uint64_t sourceSize;
+    int64_t sourceTime;
+    const std::string filename = csvFilename + SNAPSHOT_EXTENSION;
+
+    this->close();
+
+    // missing CSV file or snapshot means there is nothing to compare with
+    if (!readFileStamp(csvFilename, sourceSize, sourceTime) || !std::filesystem::exists(filename))
+    {
+        return false;
+    }
+
+    try
+    {
+        mFile.open(filename);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    // validate header, snapshot of lenient deserialization isn't valid for stricter one
+    const SnapshotHeader* header = reinterpret_cast<const SnapshotHeader*>(mFile.data());
+    if (mFile.size() < sizeof(SnapshotHeader) ||
+        std::memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) ||
+        header->version != SNAPSHOT_VERSION ||
+        header->type != static_cast<uint32_t>(type) ||
+        header->recordSize != recordSize ||
+        header->numOfSkippedRows > errorBudget ||
+        header->sourceSize != sourceSize ||
+        header->sourceTime != sourceTime)
+    {
+        mFile.close();
+        return false;
+    }
+
+    // validate size & checksum of content
+    const size_t contentSize = mFile.size() - sizeof(SnapshotHeader);
+    if (header->numOfRecords > contentSize / recordSize ||
+        header->poolSize != contentSize - header->numOfRecords * recordSize ||
+        header->checksum != calculateChecksum(mFile.data() + sizeof(SnapshotHeader), contentSize, CHECKSUM_OFFSET_BASIS))
+    {
+        mFile.close();
+        return false;
+    }
+
+    // validate records, so users of snapshot don't check them on every access
+    mHeader = header;
+    if (validateRecord)
+    {
+        const char* records = static_cast<const char*>(this->getRecords());
+        const std::string_view pool = this->getPool();
+        for (size_t i = 0; i < header->numOfRecords; i++)
+        {
+            if (!validateRecord(records + i * recordSize, pool))
+            {
+                this->close();
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void Snapshot::close()
+{
+    mFile.close();
+    mHeader = nullptr;
+}
+
+bool Snapshot::isOpen() const
+{
+    return mHeader != nullptr;
+}
+
+const void* Snapshot::getRecords() const
+{
+    return (mHeader) ? mFile.data() + sizeof(SnapshotHeader) : nullptr;
+}
+
+size_t Snapshot::getNumOfRecords() const
+{
+    return (mHeader) ? mHeader->numOfRecords : 0;
+}
+
+std::string_view Snapshot::getPool() const
+{
+    if (!mHeader)
+    {
+        return std::string_view();
+    }
+    return std::string_view(mFile.data() + sizeof(SnapshotHeader) + mHeader->numOfRecords * mHeader->recordSize, mHeader->poolSize);
+}
+
+static bool readFileStamp(const std::string& filename, uint64_t& size, int64_t& time)
+{
+    std::error_code error;
+
+    size = std::filesystem::file_size(filename, error);
+    if (error)
+    {
+        return false;
+    }
+    time = std::filesystem::last_write_time(filename, error).time_since_epoch().count();
+    return !error;
+}
+
+static uint64_t calculateChecksum(const char* data, size_t length, uint64_t checksum)
+{
+    uint64_t word;
+    size_t i = 0;
+
+    for (; i + sizeof(word) <= length; i += sizeof(word))
+    {
+        std::memcpy(&word, data + i, sizeof(word));
+        checksum = (checksum ^ word) * CHECKSUM_PRIME;
+    }
+    for (; i < length; i++)
+    {
+        checksum = (checksum ^ static_cast<unsigned char>(data[i])) * CHECKSUM_PRIME;
+    }
+    return checksum;
+}
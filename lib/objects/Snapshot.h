@@ -0,0 +1,158 @@
+/**
+ * @file Snapshot.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Binary snapshot of shop objects (Snapshot class definition)
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "file_reader/MappedFile.h"
+
+#define SNAPSHOT_EXTENSION ".snapshot"
+#define SNAPSHOT_VERSION 3
+
+/**
+ * @brief Kind of objects stored within snapshot
+ */
+enum class SnapshotType : uint32_t
+{
+    Items = 1,
+    Discounts = 2
+};
+
+/**
+ * @brief Snapshot file header.
+ *        File layout: header | fixed width records sorted by EAN 13 | string pool
+ */
+struct SnapshotHeader
+{
+    /**
+     * @brief "AOSSNAP" with terminating zero
+     */
+    char magic[8];
+    /**
+     * @brief format version (SNAPSHOT_VERSION)
+     */
+    uint32_t version;
+    /**
+     * @brief SnapshotType of records
+     */
+    uint32_t type;
+    /**
+     * @brief size of single record in bytes
+     */
+    uint32_t recordSize;
+    /**
+     * @brief number of malformed rows skipped by lenient deserialization of CSV file
+     */
+    uint32_t numOfSkippedRows;
+    /**
+     * @brief size & last write time of source CSV file at the time of writing
+     */
+    uint64_t sourceSize;
+    int64_t sourceTime;
+    /**
+     * @brief number of records & size of string pool behind them
+     */
+    uint64_t numOfRecords;
+    uint64_t poolSize;
+    /**
+     * @brief checksum of records & string pool
+     */
+    uint64_t checksum;
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "Snapshot header shall keep its layout");
+
+/**
+ * @brief Function which checks single record against string pool (i.e. bounds of referenced string)
+ */
+using SnapshotRecordValidator = bool (*)(const void* record, std::string_view pool);
+
+/**
+ * @brief Read-only memory mapped snapshot of objects loaded from CSV file.
+ *        Snapshot lives next to its CSV file (with SNAPSHOT_EXTENSION appended) & gets stale once CSV file changes.
+ */
+class Snapshot
+{
+public:
+    /**
+     * @brief Method which writes snapshot of CSV file (atomically replaces existing one)
+     *
+     * @exception std::runtime_error if writing has failed
+     *
+     * @param[in] csvFilename - source CSV file of objects
+     * @param[in] type - kind of objects
+     * @param[in] records - records sorted by EAN 13
+     * @param[in] recordSize - size of single record
+     * @param[in] numOfRecords - number of records
+     * @param[in] pool - strings referenced by records
+     * @param[in] numOfSkippedRows - number of malformed rows skipped while objects were deserialized
+     */
+    static void write(const std::string& csvFilename, SnapshotType type, const void* records, size_t recordSize, size_t numOfRecords,
+                      std::string_view pool, size_t numOfSkippedRows) noexcept(false);
+
+    /**
+     * @brief Method which maps snapshot of CSV file
+     *
+     * @param[in] csvFilename - source CSV file of objects
+     * @param[in] type - expected kind of objects
+     * @param[in] recordSize - expected size of single record
+     * @param[in] errorBudget - error budget of deserialization which snapshot replaces
+     * @param[in] validateRecord - check of every record, run within validation of content (NULL means no check)
+     * @return true - snapshot is mapped
+     * @return false - snapshot is missing, stale, corrupted, of other version/type or it skipped more rows
+     *                 than error budget allows (nothing is mapped)
+     */
+    bool open(const std::string& csvFilename, SnapshotType type, size_t recordSize, size_t errorBudget,
+              SnapshotRecordValidator validateRecord = nullptr);
+    /**
+     * @brief Method which unmaps snapshot
+     */
+    void close();
+
+    /**
+     * @brief Check is snapshot mapped
+     *
+     * @return true - snapshot is mapped
+     * @return false - snapshot is not mapped
+     */
+    bool isOpen() const;
+    /**
+     * @brief Get the first record
+     *
+     * @return const void* - records sorted by EAN 13 (8 bytes aligned)
+     */
+    const void* getRecords() const;
+    /**
+     * @brief Get the number of records
+     *
+     * @return size_t - number of records
+     */
+    size_t getNumOfRecords() const;
+    /**
+     * @brief Get the string pool
+     *
+     * @return std::string_view - strings referenced by records
+     */
+    std::string_view getPool() const;
+private:
+    /**
+     * @brief mapped snapshot file
+     */
+    MappedFile mFile;
+    /**
+     * @brief header of mapped snapshot (NULL if snapshot is not mapped)
+     */
+    const SnapshotHeader* mHeader = nullptr;
+};
@@ -0,0 +1,72 @@
+#include <cstring>
+
+#include "StringPool.h"
+
+#define STRING_POOL_BLOCK_LEN (64 * 1024)
+
+StringPool::StringPool(StringPool&& other) noexcept :
+    mBlocks{std::move(other.mBlocks)},
+    mFree{other.mFree},
+    mFreeLength{other.mFreeLength}
+{
+    other.clear();
+}
+
+StringPool& StringPool::operator=(StringPool&& other) noexcept
+{
+    if (this != &other)
+    {
+        mBlocks = std::move(other.mBlocks);
+        mFree = other.mFree;
+        mFreeLength = other.mFreeLength;
+        other.clear();
+    }
+    return *this;
+}
+
+std::string_view StringPool::add(std::string_view string)
+{
+    if (string.empty())
+    {
+        return std::string_view();
+    }
+
+    if (string.length() > mFreeLength)
+    {
+        if (string.length() > STRING_POOL_BLOCK_LEN / 4)
+        {
+            // big string gets its own block, free space of current block stays usable
+            mBlocks.push_back(std::make_unique<char[]>(string.length()));
+            char* copy = mBlocks.back().get();
+            std::memcpy(copy, string.data(), string.length());
+            return std::string_view(copy, string.length());
+        }
+
+        // start new block
+        mBlocks.push_back(std::make_unique<char[]>(STRING_POOL_BLOCK_LEN));
+        mFree = mBlocks.back().get();
+        mFreeLength = STRING_POOL_BLOCK_LEN;
+    }
+
+    char* copy = mFree;
+    std::memcpy(copy, string.data(), string.length());
+    mFree += string.length();
+    mFreeLength -= string.length();
+    return std::string_view(copy, string.length());
+}
+
+void StringPool::merge(StringPool& other)
+{
+    // blocks are moved, so strings don't change their addresses
+    mBlocks.insert(mBlocks.end(), std::make_move_iterator(other.mBlocks.begin()), std::make_move_iterator(other.mBlocks.end()));
+    other.mBlocks.clear();
+    other.mFree = nullptr;
+    other.mFreeLength = 0;
+}
+
+void StringPool::clear()
+{
+    mBlocks.clear();
+    mFree = nullptr;
+    mFreeLength = 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file StringPool.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief StringPool class definition
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Append-only storage of strings.
+ *        Strings are copied into big blocks, so views of them stay valid until pool is cleared or destroyed.
+ */
+class StringPool
+{
+public:
+    /**
+     * @brief Construct a new empty StringPool object
+     */
+    StringPool() = default;
+    /**
+     * @brief Move constructor, other pool is left empty (views of its strings stay valid)
+     */
+    StringPool(StringPool&& other) noexcept;
+    /**
+     * @brief Move assignment, strings of this pool are released & other pool is left empty
+     */
+    StringPool& operator=(StringPool&& other) noexcept;
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /**
+     * @brief Method which copies string into pool
+     *
+     * @param[in] string - string to copy
+     * @return std::string_view - view of copy within pool
+     */
+    std::string_view add(std::string_view string);
+    /**
+     * @brief Method which takes over every block of other pool (views of other pool stay valid)
+     *
+     * @param[in, out] other - pool to empty
+     */
+    void merge(StringPool& other);
+    /**
+     * @brief Method which releases every string of pool
+     */
+    void clear();
+private:
+    /**
+     * @brief blocks of strings
+     */
+    std::vector<std::unique_ptr<char[]>> mBlocks;
+    /**
+     * @brief free space within the last block
+     */
+    char* mFree = nullptr;
+    size_t mFreeLength = 0;
+};
@@ -3,8 +3,10 @@ TEMPLATE = subdirs
 SUBDIRS += lib
 SUBDIRS += test
 SUBDIRS += app
+SUBDIRS += bench
 
 CONFIG += ordered
 
 test.depends = lib
 app.depends = lib
+bench.depends = lib
@@ -0,0 +1,141 @@
+// standard library
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <memory/Arena.h>
+#include <objects/EanMap.h>
+
+/**
+ * @brief Upstream resource which counts blocks in use
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    size_t numOfBlocks = 0;
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        numOfBlocks++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+    {
+        numOfBlocks--;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+TEST(Arena_TestSuite, SucceedAllocate_AlignedAndCounted)
+{
+    Arena arena;
+
+    void* first = arena.allocate(3, 1);
+    void* second = arena.allocate(sizeof(uint64_t), alignof(uint64_t));
+    void* third = arena.allocate(64, 64);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(second) % alignof(uint64_t), 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(third) % 64, 0u);
+    EXPECT_GE(static_cast<std::byte*>(second), static_cast<std::byte*>(first) + 3);
+    EXPECT_GE(static_cast<std::byte*>(third), static_cast<std::byte*>(second) + sizeof(uint64_t));
+
+    EXPECT_EQ(arena.getNumOfAllocations(), 3u);
+    EXPECT_EQ(arena.getNumOfUpstreamAllocations(), 1u);
+    EXPECT_EQ(arena.getCapacity(), static_cast<size_t>(ARENA_MIN_BLOCK_SIZE));
+    EXPECT_GE(arena.getUsed(), 3u + sizeof(uint64_t) + 64u);
+}
+
+TEST(Arena_TestSuite, SucceedAllocate_BiggerThanBlock)
+{
+    Arena arena;
+
+    void* pointer = arena.allocate(10 * ARENA_MIN_BLOCK_SIZE, 16);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % 16, 0u);
+    EXPECT_GE(arena.getCapacity(), 10u * ARENA_MIN_BLOCK_SIZE);
+}
+
+TEST(Arena_TestSuite, SucceedReset_ReusesMergedBlocks)
+{
+    Arena arena;
+
+    // working set spread over many blocks
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_NE(arena.allocate(1000, 8), nullptr);
+    }
+    const size_t capacity = arena.getCapacity();
+    const size_t upstreamAllocations = arena.getNumOfUpstreamAllocations();
+    EXPECT_GT(upstreamAllocations, 1u);
+
+    // reset merges blocks into single one
+    arena.reset();
+    EXPECT_EQ(arena.getNumOfUpstreamAllocations(), upstreamAllocations + 1);
+    EXPECT_EQ(arena.getCapacity(), capacity);
+    EXPECT_EQ(arena.getUsed(), 0u);
+
+    // the same working set doesn't trip to upstream any more
+    for (int round = 0; round < 3; round++)
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_NE(arena.allocate(1000, 8), nullptr);
+        }
+        arena.reset();
+    }
+    EXPECT_EQ(arena.getNumOfUpstreamAllocations(), upstreamAllocations + 1);
+    EXPECT_EQ(arena.getNumOfAllocations(), 400u);
+}
+
+TEST(Arena_TestSuite, SucceedRelease_ReturnsBlocksUpstream)
+{
+    CountingResource upstream;
+    {
+        Arena arena(&upstream);
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_NE(arena.allocate(1000, 8), nullptr);
+        }
+        EXPECT_EQ(upstream.numOfBlocks, arena.getNumOfUpstreamAllocations());
+
+        arena.release();
+        EXPECT_EQ(upstream.numOfBlocks, 0u);
+        EXPECT_EQ(arena.getCapacity(), 0u);
+
+        EXPECT_NE(arena.allocate(1, 1), nullptr);
+        EXPECT_EQ(upstream.numOfBlocks, 1u);
+    }
+
+    // destructor returns the rest
+    EXPECT_EQ(upstream.numOfBlocks, 0u);
+}
+
+TEST(Arena_TestSuite, SucceedEanMap_SlotsWithinArena)
+{
+    Arena arena;
+    EanMap<uint64_t> map(&arena);
+
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        map[4432441600000 + i] = i;
+    }
+    EXPECT_EQ(map.getResource(), &arena);
+    EXPECT_GT(arena.getNumOfAllocations(), 0u);
+    EXPECT_EQ(*map.find(4432441600999), 999u);
+
+    // cleared map keeps its resource
+    map.clear();
+    arena.reset();
+    map[4432441600000] = 1;
+    EXPECT_EQ(map.getResource(), &arena);
+    EXPECT_EQ(*map.find(4432441600000), 1u);
+}
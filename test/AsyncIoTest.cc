@@ -0,0 +1,189 @@
+// standard library
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <io/AsyncIo.h>
+
+#include "TestUtils.h"
+
+/**
+ * @brief Writes content into file & reads it back
+ */
+static IoTask writeThenRead(AsyncIo& io, std::string filename, std::string content, std::string& readContent, int& result)
+{
+    result = co_await AsyncIo::writeFile(io, filename, content);
+    if (result == 0)
+    {
+        result = co_await AsyncIo::readFile(io, filename, readContent);
+    }
+    co_return result;
+}
+
+/**
+ * @brief Reads single byte of pipe (request stays within kernel until pipe is written)
+ */
+static IoTask readPipe(AsyncIo& io, int fd, char& byte, int& result)
+{
+    result = co_await io.read(fd, &byte, 1, 0);
+    co_return result;
+}
+
+/**
+ * @brief Writes file, falls back to thread pool & writes file once more
+ */
+static IoTask writeThenFallBack(AsyncIo& io, std::string filename, std::string content, int& result)
+{
+    result = co_await AsyncIo::writeFile(io, filename, content);
+    io.fallBackToPool();
+    if (result == 0)
+    {
+        result = co_await AsyncIo::writeFile(io, filename, content);
+    }
+    co_return result;
+}
+
+/**
+ * @brief Get the CPU time of calling thread
+ */
+static double threadCpuMs()
+{
+    timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return time.tv_sec * 1000.0 + time.tv_nsec / 1000000.0;
+}
+
+TEST(AsyncIo_TestSuite, SucceedReadFile_WrittenContent)
+{
+    for (const AsyncIo::Backend backend : {AsyncIo::Backend::Ring, AsyncIo::Backend::ThreadPool})
+    {
+        AsyncIo io(4, backend);
+        const char* filename = "test_async.csv";
+        std::string content;
+        std::string readContent;
+        int result = -1;
+
+        // ring falls back to thread pool only if io_uring is unavailable
+        EXPECT_EQ(io.getBackend(), (AsyncIo::isRingSupported()) ? backend : AsyncIo::Backend::ThreadPool);
+
+        // content is longer than initial read buffer
+        for (int i = 0; i < 5000; i++)
+        {
+            content += std::to_string(5720092400000 + i) + ";" + std::to_string(i % 7) + "\n";
+        }
+        writeThenRead(io, filename, content, readContent, result).start();
+        io.run();
+        EXPECT_EQ(result, 0);
+        EXPECT_EQ(readContent, content);
+
+        // file is the same as written one
+        EXPECT_EQ(readFile(filename), content);
+
+        // make sure that file has been deleted
+        std::remove(filename);
+    }
+}
+
+TEST(AsyncIo_TestSuite, SucceedRun_MoreFilesThanDepth)
+{
+    for (const AsyncIo::Backend backend : {AsyncIo::Backend::Auto, AsyncIo::Backend::ThreadPool})
+    {
+        const size_t numOfFiles = 40;
+        AsyncIo io(4, backend);
+        std::vector<std::string> contents(numOfFiles);
+        std::vector<std::string> readContents(numOfFiles);
+        std::vector<int> results(numOfFiles, -1);
+
+        // every file is in flight at once, requests beyond depth wait for free entries
+        for (size_t i = 0; i < numOfFiles; i++)
+        {
+            contents[i] = std::string(i * 1000, static_cast<char>('a' + i % 26));
+            writeThenRead(io, "test_async_" + std::to_string(i) + ".csv", contents[i], readContents[i], results[i]).start();
+        }
+        io.run();
+
+        for (size_t i = 0; i < numOfFiles; i++)
+        {
+            EXPECT_EQ(results[i], 0);
+            EXPECT_EQ(readContents[i], contents[i]);
+            std::remove(("test_async_" + std::to_string(i) + ".csv").c_str());
+        }
+    }
+}
+
+TEST(AsyncIo_TestSuite, FailedReadFile_NonExistingFile)
+{
+    for (const AsyncIo::Backend backend : {AsyncIo::Backend::Auto, AsyncIo::Backend::ThreadPool})
+    {
+        AsyncIo io(2, backend);
+        const char* filename = "test_async_missing.csv";
+        std::string content;
+        int result = 0;
+
+        // make sure that file will not exist
+        std::remove(filename);
+
+        // expect negative errno of open
+        [](AsyncIo& io, std::string filename, std::string& content, int& result) -> IoTask
+        {
+            result = co_await AsyncIo::readFile(io, filename, content);
+            co_return result;
+        }(io, filename, content, result).start();
+        io.run();
+        EXPECT_EQ(result, -ENOENT);
+    }
+}
+
+TEST(AsyncIo_TestSuite, SucceedRun_FallBackWhileRingRequestIsInFlight)
+{
+    if (!AsyncIo::isRingSupported())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    AsyncIo io(4, AsyncIo::Backend::Ring);
+    const char* filename = "test_async_fallback.csv";
+    const std::string content = "5720092400000;1\n";
+    const int delayMs = 200;
+    int fds[2];
+    char byte = 0;
+    int readResult = -1;
+    int writeResult = -1;
+
+    // read of empty pipe stays within io_uring, while the other task falls back & writes file on thread pool
+    ASSERT_EQ(pipe(fds), 0);
+    readPipe(io, fds[0], byte, readResult).start();
+    writeThenFallBack(io, filename, content, writeResult).start();
+    std::thread writer([&]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+        EXPECT_EQ(write(fds[1], "x", 1), 1);
+    });
+
+    // run waits for the pipe instead of spinning
+    const double cpuMs = threadCpuMs();
+    io.run();
+    writer.join();
+    EXPECT_LT(threadCpuMs() - cpuMs, delayMs / 2);
+
+    EXPECT_EQ(io.getBackend(), AsyncIo::Backend::ThreadPool);
+    EXPECT_EQ(readResult, 1);
+    EXPECT_EQ(byte, 'x');
+    EXPECT_EQ(writeResult, 0);
+    EXPECT_EQ(readFile(filename), content);
+
+    // make sure that file has been deleted
+    close(fds[0]);
+    close(fds[1]);
+    std::remove(filename);
+}
@@ -0,0 +1,122 @@
+// standard library
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <bill/IBillSink.h>
+#include <bill/BinaryBill.h>
+
+/**
+ * @brief Renders bill of lines with sink, buffer is sized the same way as by ProcessedOrders
+ */
+static std::string formatBill(const IBillSink& sink, const BillSummary& summary, const std::vector<BillLine>& lines)
+{
+    size_t capacity = sink.getMaxLength(summary);
+    for (const BillLine& line : lines)
+    {
+        capacity += sink.getMaxLength(line);
+    }
+
+    std::string bill(capacity, '\0');
+    char* out = sink.writeHeader(bill.data(), summary);
+    for (const BillLine& line : lines)
+    {
+        out = sink.writeLine(out, summary, line);
+    }
+    out = sink.writeFooter(out, summary);
+    bill.resize(static_cast<size_t>(out - bill.data()));
+    return bill;
+}
+
+/**
+ * @brief Lines of bill, the 2nd name needs quoting & escaping
+ */
+static std::vector<BillLine> makeLines()
+{
+    std::vector<BillLine> lines(2);
+    lines[0].ean13 = 5720092407427;
+    lines[0].name = "Fanta";
+    lines[0].taxPercent = Percent::parse("3.5");
+    lines[0].unitPrice = Money::parse("1.25");
+    lines[0].quantity = Quantity::parse("2");
+    lines[0].finalPrice = Money::parse("2.50");
+    lines[1].ean13 = 5720092407428;
+    lines[1].name = "Say \"Hi\";\\\t";
+    lines[1].taxPercent = Percent::parse("12");
+    lines[1].discountPercent = Percent::parse("30");
+    lines[1].unitPrice = Money::parse("699.99");
+    lines[1].quantity = Quantity::parse("1.005");
+    lines[1].finalPrice = Money::parse("703.49");
+    return lines;
+}
+
+TEST(BillSink_TestSuite, FailedCreate_UnknownFormat)
+{
+    EXPECT_ANY_THROW(IBillSink::create("xml"));
+    EXPECT_ANY_THROW(IBillSink::create(""));
+}
+
+TEST(BillSink_TestSuite, SucceedCreate_FilenameOfFormat)
+{
+    EXPECT_EQ(IBillSink::create("text")->getBillFilename(7), "processed_order_7.txt");
+    EXPECT_EQ(IBillSink::create("csv")->getBillFilename(7), "processed_order_7.csv");
+    EXPECT_EQ(IBillSink::create("jsonl")->getBillFilename(7), "processed_order_7.jsonl");
+    EXPECT_EQ(IBillSink::create("binary")->getBillFilename(7), "processed_order_7.bin");
+    EXPECT_TRUE(IBillSink::create("binary")->getOpenMode() & std::ios::binary);
+    EXPECT_FALSE(IBillSink::create("text")->getOpenMode() & std::ios::binary);
+}
+
+TEST(BillSink_TestSuite, SucceedFormat_Csv)
+{
+    const BillSummary summary{3, 2, Money::parse("705.99")};
+
+    // every fraction digit is kept, name with delimiter or quote is quoted
+    EXPECT_EQ(formatBill(*IBillSink::create("csv"), summary, makeLines()),
+        "order;ean13;name;tax;discount;unit_price;quantity;price\n"
+        "3;5720092407427;Fanta;3.50;0.00;1.25;2.000;2.50\n"
+        "3;5720092407428;\"Say \"\"Hi\"\";\\\t\";12.00;30.00;699.99;1.005;703.49\n");
+}
+
+TEST(BillSink_TestSuite, SucceedFormat_JsonLines)
+{
+    const BillSummary summary{3, 2, Money::parse("705.99")};
+
+    // object per line & summary object, quotes, backslashes & control characters are escaped
+    EXPECT_EQ(formatBill(*IBillSink::create("jsonl"), summary, makeLines()),
+        "{\"order\":3,\"ean13\":5720092407427,\"name\":\"Fanta\",\"tax\":3.50,\"discount\":0.00,\"unitPrice\":1.25,\"quantity\":2.000,\"price\":2.50}\n"
+        "{\"order\":3,\"ean13\":5720092407428,\"name\":\"Say \\\"Hi\\\";\\\\\\u0009\",\"tax\":12.00,\"discount\":30.00,\"unitPrice\":699.99,\"quantity\":1.005,\"price\":703.49}\n"
+        "{\"order\":3,\"lines\":2,\"total\":705.99}\n");
+}
+
+TEST(BillSink_TestSuite, SucceedFormat_Binary)
+{
+    const BillSummary summary{3, 2, Money::parse("705.99")};
+    const std::string bill = formatBill(*IBillSink::create("binary"), summary, makeLines());
+    BinaryBillHeader header;
+    BinaryBillRecord record;
+
+    // header followed by fixed width records in minor units
+    ASSERT_EQ(bill.size(), sizeof(BinaryBillHeader) + 2 * sizeof(BinaryBillRecord));
+    std::memcpy(&header, bill.data(), sizeof(header));
+    EXPECT_STREQ(header.magic, BINARY_BILL_MAGIC);
+    EXPECT_EQ(header.version, static_cast<uint32_t>(BINARY_BILL_VERSION));
+    EXPECT_EQ(header.recordSize, sizeof(BinaryBillRecord));
+    EXPECT_EQ(header.orderNum, 3u);
+    EXPECT_EQ(header.numOfRecords, 2u);
+    EXPECT_EQ(header.total, 70599);
+
+    std::memcpy(&record, bill.data() + sizeof(header) + sizeof(record), sizeof(record));
+    EXPECT_EQ(record.ean13, 5720092407428u);
+    EXPECT_EQ(record.unitPrice, 69999);
+    EXPECT_EQ(record.quantity, 1005);
+    EXPECT_EQ(record.finalPrice, 70349);
+    EXPECT_EQ(record.taxPercent, 1200);
+    EXPECT_EQ(record.discountPercent, 3000);
+    EXPECT_EQ(std::string(record.name, strnlen(record.name, BINARY_BILL_NAME_LEN)), "Say \"Hi\";\\\t");
+}
@@ -0,0 +1,129 @@
+// standard library
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <bill/BinaryBillReader.h>
+#include <bill/BinaryBillSink.h>
+#include <objects/Items.h>
+#include <objects/Discounts.h>
+#include <objects/Orders.h>
+#include <objects/ProcessedOrders.h>
+#include <file_reader/CsvReader.h>
+
+TEST(BinaryBillReader_TestSuite, FailedOpen_NonExistingFile)
+{
+    BinaryBillReader reader;
+    const char* filename = "test_bill.bin";
+
+    // make sure that file will not exist
+    std::remove(filename);
+
+    EXPECT_ANY_THROW(reader.open(filename));
+    EXPECT_ANY_THROW(reader.getHeader());
+}
+
+TEST(BinaryBillReader_TestSuite, FailedOpen_BadOrTruncatedFile)
+{
+    BinaryBillReader reader;
+    const char* filename = "test_bill.bin";
+    std::ofstream writer;
+
+    // text isn't binary bill
+    writer.open(filename);
+    writer << "Order #1\n";
+    writer.close();
+    EXPECT_ANY_THROW(reader.open(filename));
+
+    // header promises record which is missing
+    BinaryBillHeader header = {};
+    std::memcpy(header.magic, BINARY_BILL_MAGIC, BINARY_BILL_MAGIC_LEN);
+    header.version = BINARY_BILL_VERSION;
+    header.recordSize = sizeof(BinaryBillRecord);
+    header.numOfRecords = 1;
+    writer.open(filename, std::ios::binary);
+    writer.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writer.close();
+    EXPECT_ANY_THROW(reader.open(filename));
+    EXPECT_ANY_THROW(reader.getRecords());
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(BinaryBillReader_TestSuite, SucceedRead_SameAsProcessedOrders)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* discount_filename = "test_discount.csv";
+    const char* order_filename = "test_order.csv";
+    const char* bill_filename = "test_bill.bin";
+    const BinaryBillSink sink;
+    std::ofstream writer;
+    Items item;
+    Discounts discount;
+    Orders order;
+    ProcessedOrders proc;
+    BinaryBillReader bill;
+
+    // create files with ofstream & write some data, one name is longer than name of record
+    writer.open(item_filename);
+    writer << "5720092407427;Fanta;1.21;3.5\n5720092407428;Very Long Name Of Product Which Is Cut;699.99;12\n5720092407429;Apple;0.5;8";
+    writer.close();
+    writer.open(discount_filename);
+    writer << "5720092407428;30";
+    writer.close();
+    writer.open(order_filename);
+    writer << "5720092407427;2\n5720092407428;1.005\n5720092407429;3";
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(discount_filename);
+    ASSERT_NO_THROW(discount << reader);
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+    ASSERT_NO_THROW(proc.processOrder(&order, &item, &discount));
+
+    // write bill
+    writer.open(bill_filename, sink.getOpenMode());
+    proc.writeBill(writer, sink);
+    writer.close();
+
+    // records are mapped in bill order (by item name)
+    ASSERT_NO_THROW(bill.open(bill_filename));
+    EXPECT_EQ(bill.getHeader().orderNum, proc.getOrderNum());
+    EXPECT_EQ(Money::fromMinorUnits(bill.getHeader().total), proc.getTotal());
+    ASSERT_EQ(bill.getRecords().size(), 3u);
+    EXPECT_EQ(bill.getLine(0).name, "Apple");
+    EXPECT_EQ(bill.getLine(1).name, "Fanta");
+    EXPECT_EQ(bill.getLine(2).name, std::string("Very Long Name Of Product Which Is Cut").substr(0, BINARY_BILL_NAME_LEN));
+    EXPECT_ANY_THROW(bill.getLine(3));
+
+    Money total;
+    for (size_t i = 0; i < bill.getRecords().size(); i++)
+    {
+        const BillLine line = bill.getLine(i);
+        const ProcessedOrder* processedOrder = proc.getProcessedOrder(line.ean13);
+        ASSERT_NE(processedOrder, nullptr);
+        EXPECT_EQ(line.taxPercent, processedOrder->taxPercent);
+        EXPECT_EQ(line.discountPercent, processedOrder->discountPercent);
+        EXPECT_EQ(line.unitPrice, processedOrder->unitPrice);
+        EXPECT_EQ(line.quantity, processedOrder->quantity);
+        EXPECT_EQ(line.finalPrice, processedOrder->finalPrice);
+        total += line.finalPrice;
+    }
+    EXPECT_EQ(total, proc.getTotal());
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(discount_filename);
+    std::remove(order_filename);
+    std::remove(bill_filename);
+}
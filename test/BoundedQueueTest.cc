@@ -0,0 +1,137 @@
+// standard library
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <concurrency/BoundedQueue.h>
+
+TEST(BoundedQueue_TestSuite, SucceedPop_FirstInFirstOut)
+{
+    BoundedQueue<std::unique_ptr<int>> queue(3);
+    std::unique_ptr<int> value;
+
+    // capacity is kept even if ring is longer
+    EXPECT_EQ(queue.capacity(), 3u);
+    for (int lap = 0; lap < 5; lap++)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            queue.push(std::make_unique<int>(lap * 10 + i));
+        }
+        EXPECT_EQ(queue.size(), 3u);
+        for (int i = 0; i < 3; i++)
+        {
+            ASSERT_TRUE(queue.pop(value));
+            EXPECT_EQ(*value, lap * 10 + i);
+        }
+        EXPECT_EQ(queue.size(), 0u);
+    }
+
+    // closed queue gives the rest of values, then nothing
+    queue.push(std::make_unique<int>(7));
+    queue.close();
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(*value, 7);
+    EXPECT_FALSE(queue.pop(value));
+    EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(BoundedQueue_TestSuite, SucceedPush_BlocksWhileFull)
+{
+    BoundedQueue<int> queue(2);
+    std::atomic<int> pushed = 0;
+    int value;
+
+    std::thread producer([&queue, &pushed]()
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            queue.push(i);
+            pushed++;
+        }
+    });
+
+    // producer waits for consumer (backpressure)
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(pushed, 2);
+    EXPECT_EQ(queue.size(), 2u);
+
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+    producer.join();
+    EXPECT_EQ(pushed, 4);
+}
+
+TEST(BoundedQueue_TestSuite, SucceedPop_EveryValueOnceBetweenThreads)
+{
+    const size_t numOfProducers = 3;
+    const size_t numOfConsumers = 3;
+    const uint64_t numOfValues = 20000;
+    BoundedQueue<uint64_t> queue(4);
+    std::vector<std::thread> threads;
+    std::vector<uint64_t> sums(numOfConsumers);
+    std::vector<uint64_t> counts(numOfConsumers);
+    std::atomic<size_t> maxSize = 0;
+
+    for (size_t i = 0; i < numOfConsumers; i++)
+    {
+        threads.emplace_back([&queue, &sums, &counts, i]()
+        {
+            uint64_t value;
+            uint64_t previous[numOfProducers] = {};
+            while (queue.pop(value))
+            {
+                // values of single producer keep their order
+                EXPECT_GT(value / numOfProducers + 1, previous[value % numOfProducers]);
+                previous[value % numOfProducers] = value / numOfProducers + 1;
+                sums[i] += value;
+                counts[i]++;
+            }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < numOfProducers; i++)
+    {
+        producers.emplace_back([&queue, &maxSize, i]()
+        {
+            for (uint64_t value = i; value < numOfValues * numOfProducers; value += numOfProducers)
+            {
+                queue.push(value);
+                maxSize = std::max<size_t>(maxSize, queue.size());
+            }
+        });
+    }
+
+    // queue is closed once every producer has finished
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    queue.close();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    uint64_t sum = 0;
+    uint64_t count = 0;
+    for (size_t i = 0; i < numOfConsumers; i++)
+    {
+        sum += sums[i];
+        count += counts[i];
+    }
+    const uint64_t total = numOfValues * numOfProducers;
+    EXPECT_EQ(count, total);
+    EXPECT_EQ(sum, total * (total - 1) / 2);
+    EXPECT_LE(maxSize, queue.capacity());
+}
@@ -0,0 +1,78 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstdio>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <file_reader/BufferCsvReader.h>
+#include <file_reader/MmapCsvReader.h>
+
+TEST(BufferCsvReader_TestSuite, FailedOpen_NonExistingFile)
+{
+    BufferCsvReader reader;
+    const char* filename = "test.csv";
+
+    // make sure that file will not exist
+    std::remove(filename);
+
+    // expect reader to throw exception if file doesn't exist
+    EXPECT_ANY_THROW(reader.open(filename));
+    EXPECT_ANY_THROW(reader.read());
+}
+
+TEST(BufferCsvReader_TestSuite, FailedOpen_BadFileExtension)
+{
+    BufferCsvReader reader;
+
+    // expect reader to throw exception even if content is already read
+    EXPECT_ANY_THROW(reader.open("test.txt", "5720092400000;1\n"));
+    EXPECT_ANY_THROW(reader.read());
+}
+
+TEST(BufferCsvReader_TestSuite, SucceedRead_SameRowsAsMmapCsvReader)
+{
+    BufferCsvReader reader;
+    MmapCsvReader mmapReader;
+    const char* filename = "test.csv";
+    const std::string content = "5720092400000;1.5\r\n\n  5720092400001 ; 2\n5720092400002;3";
+
+    // create file with ofstream & write some data
+    std::ofstream writer(filename, std::ios::binary);
+    writer << content;
+    writer.close();
+
+    // the same rows whether buffer is read by reader or given to it
+    for (int pass = 0; pass < 2; pass++)
+    {
+        if (pass == 0)
+        {
+            reader.open(filename);
+        }
+        else
+        {
+            reader.open(filename, content);
+        }
+        mmapReader.open(filename);
+
+        std::string line;
+        std::string mmapLine;
+        while (mmapReader.read(&mmapLine))
+        {
+            ASSERT_TRUE(reader.read(&line));
+            EXPECT_EQ(line, mmapLine);
+            EXPECT_EQ(reader.getRowNum(), mmapReader.getRowNum());
+        }
+        EXPECT_FALSE(reader.read());
+    }
+
+    // released buffer is the content of file
+    EXPECT_EQ(reader.release(), content);
+    EXPECT_ANY_THROW(reader.read());
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
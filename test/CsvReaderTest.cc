@@ -330,3 +330,28 @@ TEST(CsvReader_TestSuite, SucceedExtract_CrLfNewline)
     // make sure that file has been deleted
     std::remove(filename);
 }
+
+TEST(CsvReader_TestSuite, SucceedExtractStringView_TrimmedCells)
+{
+    CsvReader reader;
+    const char* filename = "test.csv";
+
+    reader.setNumOfCols(3);
+
+    // create file with ofstream, write data padded with whitespaces & tabs & close it
+    std::ofstream writer(filename);
+    writer << " \t Hello world;\t\t;\t 42\r\r\n";
+    writer.close();
+
+    // open the file with reader & read line
+    reader.open(filename);
+    reader.read();
+
+    // expect reader to trim cells without copying them
+    EXPECT_EQ(reader.extractStringView(), "Hello world");
+    EXPECT_EQ(reader.extractStringView(), "");
+    EXPECT_EQ(reader.extractULongLong(), 42);
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
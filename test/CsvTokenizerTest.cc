@@ -0,0 +1,138 @@
+// standard library
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <random>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <file_reader/CsvTokenizer.h>
+
+/**
+ * @brief Reference row scan: plain character loop
+ */
+static size_t referenceScanRow(std::string_view data, std::vector<uint32_t>& semicolons)
+{
+    semicolons.clear();
+    for (size_t i = 0; i < data.length(); i++)
+    {
+        if (data[i] == '\n')
+        {
+            return i;
+        }
+        if (data[i] == ';')
+        {
+            semicolons.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return data.length();
+}
+
+/**
+ * @brief Reference tokenization: split rows & cells, then trim every cell
+ */
+static void referenceTokenize(std::string_view data, std::vector<std::string_view>& cells, std::vector<size_t>& rowEnds)
+{
+    size_t cellStart = 0;
+    for (size_t i = 0; i < data.length(); i++)
+    {
+        if (data[i] == ';' || data[i] == '\n')
+        {
+            cells.push_back(CsvTokenizer::trim(data.substr(cellStart, i - cellStart)));
+            if (data[i] == '\n')
+            {
+                rowEnds.push_back(cells.size());
+            }
+            cellStart = i + 1;
+        }
+    }
+    if (cellStart < data.length())
+    {
+        cells.push_back(CsvTokenizer::trim(data.substr(cellStart)));
+        rowEnds.push_back(cells.size());
+    }
+}
+
+/**
+ * @brief Generates random CSV-like buffer out of delimiters, blanks & few letters
+ */
+static std::string generateBuffer(std::mt19937& generator, size_t length)
+{
+    static const char alphabet[] = ";;\t\t  \r\n\nab1.";
+    std::uniform_int_distribution<size_t> distribution(0, sizeof(alphabet) - 2);
+    std::string buffer(length, ' ');
+    for (char& c : buffer)
+    {
+        c = alphabet[distribution(generator)];
+    }
+    return buffer;
+}
+
+TEST(CsvTokenizer_TestSuite, Trim_BlanksInFrontNewlineAtBack)
+{
+    EXPECT_EQ(CsvTokenizer::trim(" \t Coca-Cola\r\r"), "Coca-Cola");
+    EXPECT_EQ(CsvTokenizer::trim("Fanta \t"), "Fanta \t");
+    EXPECT_EQ(CsvTokenizer::trim("\r 1.21"), "\r 1.21");
+    EXPECT_EQ(CsvTokenizer::trim(" \t\r\n"), "");
+    EXPECT_EQ(CsvTokenizer::trim(""), "");
+}
+
+TEST(CsvTokenizer_TestSuite, ScanRow_ItemsRow)
+{
+    const std::string row = "4432441693730;\tComa-Cola;\t\t1.21;\t\t3.5\r\nnext;row";
+    std::vector<uint32_t> semicolons;
+
+    EXPECT_EQ(CsvTokenizer::scanRow(row.data(), row.length(), semicolons), row.find('\n'));
+    EXPECT_EQ(semicolons, (std::vector<uint32_t>{13, 24, 31}));
+}
+
+TEST(CsvTokenizer_TestSuite, EveryIsaMatchesReference)
+{
+    const CsvTokenizer::Isa initialIsa = CsvTokenizer::getIsa();
+    std::mt19937 generator(2022);
+
+    for (const CsvTokenizer::Isa isa : {CsvTokenizer::Isa::Scalar, CsvTokenizer::Isa::Sse2, CsvTokenizer::Isa::Avx2})
+    {
+        // unsupported instruction set falls back to supported one, which is also fine to check
+        CsvTokenizer::setIsa(isa);
+
+        for (size_t length : {0, 1, 63, 64, 65, 127, 128, 200, 1000, 5000})
+        {
+            const std::string buffer = generateBuffer(generator, length);
+
+            // scan every row of buffer
+            std::vector<uint32_t> semicolons;
+            std::vector<uint32_t> referenceSemicolons;
+            for (size_t offset = 0; offset < length;)
+            {
+                const std::string_view rest(buffer.data() + offset, length - offset);
+                const size_t rowLength = CsvTokenizer::scanRow(rest.data(), rest.length(), semicolons);
+                ASSERT_EQ(rowLength, referenceScanRow(rest, referenceSemicolons));
+                ASSERT_EQ(semicolons, referenceSemicolons);
+                offset += rowLength + 1;
+            }
+
+            // tokenize whole buffer
+            std::vector<CsvCell> cells;
+            std::vector<size_t> rowEnds;
+            std::vector<std::string_view> referenceCells;
+            std::vector<size_t> referenceRowEnds;
+            CsvTokenizer::tokenize(buffer.data(), length, cells, rowEnds);
+            referenceTokenize(buffer, referenceCells, referenceRowEnds);
+
+            ASSERT_EQ(rowEnds, referenceRowEnds);
+            ASSERT_EQ(cells.size(), referenceCells.size());
+            for (size_t i = 0; i < cells.size(); i++)
+            {
+                const std::string_view cell(buffer.data() + cells[i].begin, cells[i].end - cells[i].begin);
+                ASSERT_EQ(cell.data(), referenceCells[i].data()) << "cell " << i << " of " << length;
+                ASSERT_EQ(cell, referenceCells[i]) << "cell " << i << " of " << length;
+            }
+        }
+    }
+
+    CsvTokenizer::setIsa(initialIsa);
+}
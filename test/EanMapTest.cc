@@ -0,0 +1,121 @@
+// standard library
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <stdexcept>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/EanMap.h>
+
+TEST(EanMap_TestSuite, SucceedInsert_FindsEveryKey)
+{
+    EanMap<std::string> map;
+    const size_t numOfKeys = 100000;
+    const uint64_t firstEan13 = 4432441600000;
+
+    // consecutive keys (the usual case within manufacturer prefix) & key 0 grow the map many times
+    for (size_t i = 0; i < numOfKeys; i++)
+    {
+        map[firstEan13 + i] = "Item" + std::to_string(i);
+    }
+    map[0] = "Zero";
+
+    EXPECT_EQ(map.size(), numOfKeys + 1);
+    for (size_t i = 0; i < numOfKeys; i++)
+    {
+        const std::string* value = map.find(firstEan13 + i);
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*value, "Item" + std::to_string(i));
+    }
+    ASSERT_NE(map.find(0), nullptr);
+    EXPECT_EQ(*map.find(0), "Zero");
+    EXPECT_EQ(map.find(firstEan13 + numOfKeys), nullptr);
+    EXPECT_EQ(map.find(EAN_MAP_EMPTY_KEY), nullptr);
+}
+
+TEST(EanMap_TestSuite, SucceedInsert_OverwritesExistingKey)
+{
+    EanMap<float> map;
+
+    map[4432441693730] = 1.5f;
+    map[4432441693730] = 2.5f;
+
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(*map.find(4432441693730), 2.5f);
+}
+
+TEST(EanMap_TestSuite, FailedInsert_EmptyKey)
+{
+    EanMap<float> map;
+
+    EXPECT_THROW(map[EAN_MAP_EMPTY_KEY], std::invalid_argument);
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(EanMap_TestSuite, EmptyMap_FindsNothing)
+{
+    EanMap<float> map;
+
+    EXPECT_EQ(map.find(4432441693730), nullptr);
+    EXPECT_EQ(map.begin(), map.end());
+
+    map[4432441693730] = 1.5f;
+    map.clear();
+    EXPECT_EQ(map.find(4432441693730), nullptr);
+    EXPECT_EQ(map.size(), 0u);
+}
+
+TEST(EanMap_TestSuite, SucceedIterate_VisitsEveryKeyOnce)
+{
+    EanMap<uint64_t> map;
+    std::map<uint64_t, uint64_t> expected;
+
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        map[4432441600000 + i * 7919] = i;
+        expected[4432441600000 + i * 7919] = i;
+    }
+
+    std::map<uint64_t, uint64_t> visited;
+    for (const auto& element : map)
+    {
+        EXPECT_TRUE(visited.insert({element.first, element.second}).second);
+    }
+    EXPECT_EQ(visited, expected);
+}
+
+TEST(EanMap_TestSuite, SucceedMerge_KeepsExistingKeys)
+{
+    EanMap<int> map;
+    EanMap<int> other;
+
+    map[1] = 1;
+    map[2] = 2;
+    other[2] = 20;
+    other[3] = 30;
+
+    // like std::map::merge, values of this map win
+    map.merge(other);
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(*map.find(1), 1);
+    EXPECT_EQ(*map.find(2), 2);
+    EXPECT_EQ(*map.find(3), 30);
+    EXPECT_TRUE(other.empty());
+}
+
+TEST(EanMap_TestSuite, SucceedReserve_KeepsKeys)
+{
+    EanMap<int> map;
+
+    map[4432441693730] = 7;
+    map.reserve(100000);
+    map.reserve(10);
+
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(*map.find(4432441693730), 7);
+}
@@ -0,0 +1,124 @@
+// standard library
+#include <string>
+#include <sstream>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/FixedPoint.h>
+
+TEST(FixedPoint_TestSuite, DivideRounded_HalfAwayFromZero)
+{
+    EXPECT_EQ(divideRounded<int64_t>(125, 10), 13);
+    EXPECT_EQ(divideRounded<int64_t>(124, 10), 12);
+    EXPECT_EQ(divideRounded<int64_t>(-125, 10), -13);
+    EXPECT_EQ(divideRounded<int64_t>(-124, 10), -12);
+    EXPECT_EQ(divideRounded<int64_t>(0, 10), 0);
+}
+
+TEST(FixedPoint_TestSuite, Parse_KeepsPrecisionOfType)
+{
+    EXPECT_EQ(Money::parse("1.21").getMinorUnits(), 121);
+    EXPECT_EQ(Money::parse("112.455").getMinorUnits(), 11246);
+    EXPECT_EQ(Percent::parse("3.5").getMinorUnits(), 350);
+    EXPECT_EQ(Quantity::parse("2").getMinorUnits(), 2000);
+
+    EXPECT_THROW(Money::parse("1.2x"), std::runtime_error);
+    EXPECT_THROW(Money::parse("."), std::invalid_argument);
+    // Percent keeps 32 bits only
+    EXPECT_THROW(Percent::parse("21474836.48"), std::out_of_range);
+    EXPECT_EQ(Percent::parse("21474836.47").getMinorUnits(), INT32_MAX);
+}
+
+TEST(FixedPoint_TestSuite, ToString_RoundsOnlyDroppedDigits)
+{
+    std::ostringstream stream;
+
+    EXPECT_EQ(Money::parse("14.97").toString(), "14.97");
+    EXPECT_EQ(Money::parse("5").toString(), "5.00");
+    EXPECT_EQ(Money::parse("0.05").toString(), "0.05");
+    EXPECT_EQ(Money::fromMinorUnits(-105).toString(), "-1.05");
+    EXPECT_EQ(Quantity::parse("1.005").toString(2), "1.01");
+    EXPECT_EQ(Quantity::parse("1.004").toString(2), "1.00");
+    EXPECT_EQ(Quantity::parse("2.5").toString(0), "3");
+
+    stream << Percent::parse("12");
+    EXPECT_EQ(stream.str(), "12.00");
+}
+
+TEST(FixedPoint_TestSuite, ToChars_SameAsToString)
+{
+    char text[FIXED_POINT_MAX_LEN];
+
+    // formatted into external buffer, the longest value fits into it
+    for (const int64_t minorUnits : {int64_t(0), int64_t(5), int64_t(-105), int64_t(1497), INT64_MAX, INT64_MIN + 1})
+    {
+        const Money money = Money::fromMinorUnits(minorUnits);
+        const Quantity quantity = Quantity::fromMinorUnits(minorUnits);
+        EXPECT_EQ(std::string(text, money.toChars(text)), money.toString());
+        EXPECT_EQ(std::string(text, quantity.toChars(text, 2)), quantity.toString(2));
+    }
+    EXPECT_EQ(std::string(text, Quantity::fromMinorUnits(INT64_MIN).toChars(text)), "-9223372036854775.808");
+    EXPECT_EQ(std::string(text, Money::fromMinorUnits(INT64_MIN + 1).toChars(text)), "-92233720368547758.07");
+}
+
+TEST(FixedPoint_TestSuite, Sum_IsExactInAnyOrder)
+{
+    std::vector<Money> prices;
+    Money forward;
+    Money backward;
+
+    // 0.1 + 0.2 + ... isn't exact with binary floating point
+    for (int i = 1; i <= 1000; i++)
+    {
+        prices.push_back(Money::fromMinorUnits(i * 10));
+    }
+    for (auto it = prices.begin(); it != prices.end(); it++)
+    {
+        forward += *it;
+    }
+    for (auto it = prices.rbegin(); it != prices.rend(); it++)
+    {
+        backward += *it;
+    }
+
+    EXPECT_EQ(forward, backward);
+    EXPECT_EQ(forward, Money::parse("50050"));
+}
+
+TEST(FixedPoint_TestSuite, CalculatePrices_RoundOnceToCents)
+{
+    // 699.99 * 1.12 * 0.7 = 548.792...
+    EXPECT_EQ(calculateUnitPrice(Money::parse("699.99"), Percent::parse("12"), Percent::parse("30")), Money::parse("548.79"));
+    // 4.99 * 1.088 = 5.42912
+    EXPECT_EQ(calculateUnitPrice(Money::parse("4.99"), Percent::parse("8.8"), Percent()), Money::parse("5.43"));
+    // 1.25 * 1.1 * 0.9 = 1.2375
+    EXPECT_EQ(calculateUnitPrice(Money::parse("1.25"), Percent::parse("10"), Percent::parse("10")), Money::parse("1.24"));
+    // discount above 100 % makes negative price
+    EXPECT_EQ(calculateUnitPrice(Money::parse("1"), Percent(), Percent::parse("150")), Money::fromMinorUnits(-50));
+
+    // 5.43 * 2.5 = 13.575
+    EXPECT_EQ(calculatePrice(Money::parse("5.43"), Quantity::parse("2.5")), Money::parse("13.58"));
+    EXPECT_EQ(calculatePrice(Money::parse("5.43"), Quantity::parse("0.001")), Money::parse("0.01"));
+    EXPECT_EQ(calculatePrice(Money::parse("5.43"), Quantity()), Money());
+    // intermediate product doesn't overflow
+    EXPECT_EQ(calculatePrice(Money::parse("9000000000000"), Quantity::parse("1000")), Money::parse("9000000000000000"));
+    EXPECT_EQ(calculateUnitPrice(Money::parse("90000000000000000"), Percent::parse("2.5"), Percent::parse("50")), Money::parse("46125000000000000"));
+    // negative price is rounded half away from zero too
+    EXPECT_EQ(calculatePrice(Money::fromMinorUnits(-543), Quantity::parse("2.5")), Money::fromMinorUnits(-1358));
+    EXPECT_EQ(calculatePrice(Money::parse("5.43"), Quantity::fromMinorUnits(-2500)), Money::fromMinorUnits(-1358));
+}
+
+TEST(FixedPoint_TestSuite, FailedCalculatePrices_ResultOverflow)
+{
+    EXPECT_THROW(calculatePrice(Money::parse("90000000000000000"), Quantity::parse("1000")), std::overflow_error);
+    EXPECT_THROW(calculateUnitPrice(Money::parse("90000000000000000"), Percent::parse("100"), Percent()), std::overflow_error);
+    // the lowest price still fits
+    EXPECT_EQ(calculatePrice(Money::fromMinorUnits(std::numeric_limits<int64_t>::min()), Quantity::parse("1")),
+              Money::fromMinorUnits(std::numeric_limits<int64_t>::min()));
+}
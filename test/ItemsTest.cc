@@ -3,6 +3,7 @@
 #include <fstream>
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 // GTest
 #include <gtest/gtest.h>
@@ -10,26 +11,27 @@
 // AmazingAPI
 #include <objects/Items.h>
 #include <file_reader/CsvReader.h>
+#include <file_reader/RowException.h>
 
 TEST(Items_TestSuite, CompareItemsWithDifferentFields)
 {
-    const Item a = {"test1", 112.453, 1.18f};
-    const Item b = {"test2", 15.02,   1.18f};
+    const Item a = {"test1", Money::parse("112.45"), Percent::parse("1.18")};
+    const Item b = {"test2", Money::parse("15.02"),  Percent::parse("1.18")};
 
     EXPECT_NE(a, b);
 }
 
 TEST(Items_TestSuite, CompareItemsWithSameFields)
 {
-    const Item a = {"test1", 112.453, 1.18f};
-    const Item b = {"test1", 112.453, 1.18f};
+    const Item a = {"test1", Money::parse("112.45"), Percent::parse("1.18")};
+    const Item b = {"test1", Money::parse("112.45"), Percent::parse("1.18")};
 
     EXPECT_EQ(a, b);
 }
 
 TEST(Items_TestSuite, CompareSameItem)
 {
-    const Item a = {"test1", 112.453, 1.18f};
+    const Item a = {"test1", Money::parse("112.45"), Percent::parse("1.18")};
 
     EXPECT_EQ(a, a);
 }
@@ -124,7 +126,7 @@ TEST(Items_TestSuite, SucceedDeserialization_SingleLineCheck)
     std::shared_ptr<CsvReader> reader(new CsvReader);
     const char* filename = "test.csv";
     const uint64_t ean13 = 4432441693730;
-    const Item comparingItem = {"Coca-Cola", 1.21, 3.5};
+    const Item comparingItem = {"Coca-Cola", Money::parse("1.21"), Percent::parse("3.5")};
 
     // create file with ofstream & write some data
     std::ofstream writer(filename);
@@ -136,7 +138,7 @@ TEST(Items_TestSuite, SucceedDeserialization_SingleLineCheck)
     items << reader;
 
     // expect NULL for passed bad EAN 13 id
-    EXPECT_EQ(items.getItem(ean13 + 1), nullptr);
+    EXPECT_FALSE(items.getItem(ean13 + 1));
 
     // compare deserialized item with initial
     EXPECT_EQ(*items.getItem(ean13), comparingItem);
@@ -144,3 +146,171 @@ TEST(Items_TestSuite, SucceedDeserialization_SingleLineCheck)
     // make sure that file has been deleted
     std::remove(filename);
 }
+
+TEST(Items_TestSuite, SucceedParallelDeserialization_MatchesSequential)
+{
+    Items sequentialItems;
+    Items parallelItems;
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* filename = "test.csv";
+    const size_t numOfRows = 21000;
+    const size_t numOfKeys = 7000;
+    const uint64_t firstEan13 = 4432441600000;
+
+    // create file bigger than few parallel chunks, where keys repeat across chunks
+    std::ofstream writer(filename);
+    for (size_t i = 0; i < numOfRows; i++)
+    {
+        writer << firstEan13 + i % numOfKeys << ";\tItem" << i << ";\t" << i << ".25;\t" << i % 20 << "\n";
+    }
+    writer.close();
+
+    // deserialize sequentially & on multiple threads
+    reader->open(filename);
+    sequentialItems << reader;
+    parallelItems.loadParallel(filename, 4);
+
+    // expect the last row of every key to win in both cases
+    for (size_t i = 0; i < numOfKeys; i++)
+    {
+        const std::optional<Item> sequentialItem = sequentialItems.getItem(firstEan13 + i);
+        const std::optional<Item> parallelItem = parallelItems.getItem(firstEan13 + i);
+        ASSERT_TRUE(sequentialItem);
+        ASSERT_TRUE(parallelItem);
+        EXPECT_EQ(*parallelItem, *sequentialItem);
+        EXPECT_EQ(parallelItem->name, "Item" + std::to_string(i + 2 * numOfKeys));
+    }
+    EXPECT_FALSE(parallelItems.getItem(firstEan13 + numOfKeys));
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(Items_TestSuite, FailedParallelDeserialization_ReportsRowNumber)
+{
+    Items items;
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* filename = "test.csv";
+    const size_t numOfRows = 20000;
+    const size_t badRow = 15321;
+
+    // create file bigger than few parallel chunks with single bad price
+    std::ofstream writer(filename);
+    for (size_t i = 1; i <= numOfRows; i++)
+    {
+        writer << 4432441600000 + i << ";\tItem;\t" << ((i == badRow) ? "1.2x" : "1.2") << ";\t3.5\n";
+    }
+    writer.close();
+
+    // expect row number within whole file from both sequential & parallel deserialization
+    reader->open(filename);
+    try
+    {
+        items << reader;
+        FAIL() << "sequential deserialization shall fail";
+    }
+    catch (const RowException& e)
+    {
+        EXPECT_EQ(e.getRow(), badRow);
+        EXPECT_EQ(std::string(e.what()).rfind("Row 15321: ", 0), 0u);
+    }
+    try
+    {
+        items.loadParallel(filename, 4);
+        FAIL() << "parallel deserialization shall fail";
+    }
+    catch (const RowException& e)
+    {
+        EXPECT_EQ(e.getRow(), badRow);
+        EXPECT_EQ(std::string(e.what()).rfind("Row 15321: ", 0), 0u);
+    }
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(Items_TestSuite, LenientDeserialization_SkipsMalformedRows)
+{
+    Items sequentialItems;
+    Items parallelItems;
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* filename = "test.csv";
+    const size_t numOfRows = 20000;
+    const uint64_t firstEan13 = 4432441600000;
+
+    // create file bigger than few parallel chunks, every 1000th row has bad price
+    std::ofstream writer(filename);
+    for (size_t i = 1; i <= numOfRows; i++)
+    {
+        writer << firstEan13 + i << ";\tItem;\t" << ((i % 1000 == 0) ? "1.2x" : "1.2") << ";\t3.5\n";
+    }
+    writer.close();
+
+    // deserialize sequentially & on multiple threads with enough error budget
+    sequentialItems.setErrorBudget(20);
+    parallelItems.setErrorBudget(20);
+    reader->open(filename);
+    sequentialItems << reader;
+    parallelItems.loadParallel(filename, 4);
+
+    // expect the same skipped rows, numbered within whole file
+    for (const Items* items : {&sequentialItems, &parallelItems})
+    {
+        const std::vector<RowError>& errors = items->getErrorReport().getErrors();
+        ASSERT_EQ(errors.size(), numOfRows / 1000);
+        for (size_t i = 0; i < errors.size(); i++)
+        {
+            EXPECT_EQ(errors[i].row, (i + 1) * 1000);
+            EXPECT_EQ(errors[i].column, 3);
+            EXPECT_EQ(errors[i].reason, "\"1.2x\" is not a decimal number.");
+        }
+        EXPECT_TRUE(items->getItem(firstEan13 + 999));
+        EXPECT_FALSE(items->getItem(firstEan13 + 1000));
+    }
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(Items_TestSuite, LenientDeserialization_FailsBeyondErrorBudget)
+{
+    Items items;
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* filename = "test.csv";
+    const size_t numOfRows = 20000;
+
+    // create file bigger than few parallel chunks, every 1000th row has bad price
+    std::ofstream writer(filename);
+    for (size_t i = 1; i <= numOfRows; i++)
+    {
+        writer << 4432441600000 + i << ";\tItem;\t" << ((i % 1000 == 0) ? "1.2x" : "1.2") << ";\t3.5\n";
+    }
+    writer.close();
+
+    // expect the 6th malformed row to exceed budget of 5 rows, both sequentially & in parallel
+    items.setErrorBudget(5);
+    reader->open(filename);
+    try
+    {
+        items << reader;
+        FAIL() << "sequential deserialization shall fail";
+    }
+    catch (const RowException& e)
+    {
+        EXPECT_EQ(e.getRow(), 6000u);
+        EXPECT_EQ(e.getReason(), "\"1.2x\" is not a decimal number. (error budget of 5 rows exceeded)");
+    }
+    try
+    {
+        items.loadParallel(filename, 4);
+        FAIL() << "parallel deserialization shall fail";
+    }
+    catch (const RowException& e)
+    {
+        EXPECT_EQ(e.getRow(), 6000u);
+        EXPECT_EQ(e.getReason(), "\"1.2x\" is not a decimal number. (error budget of 5 rows exceeded)");
+    }
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
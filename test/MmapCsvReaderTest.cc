@@ -0,0 +1,163 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <memory>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <file_reader/MmapCsvReader.h>
+#include <file_reader/CsvReader.h>
+#include <objects/Items.h>
+
+TEST(MmapCsvReader_TestSuite, FailedOpen_NonExistingFile)
+{
+    MmapCsvReader reader;
+    const char* filename = "test.csv";
+
+    // make sure that file will not exist
+    std::remove(filename);
+
+    // expect reader to throw exception if file doesn't exist
+    EXPECT_ANY_THROW(reader.open(filename));
+}
+
+TEST(MmapCsvReader_TestSuite, FailedOpen_BadFileExtension)
+{
+    MmapCsvReader reader;
+    const char* filename = "test.txt";
+
+    // create file with ofstream & write some data
+    std::ofstream writer(filename);
+    writer << "test\t;test\t;test\t";
+    writer.close();
+
+    // expect reader to throw exception if file exists, but has bad extension (".txt")
+    EXPECT_ANY_THROW(reader.open(filename));
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(MmapCsvReader_TestSuite, FailedRead_IfFileNotOpened)
+{
+    MmapCsvReader reader;
+
+    // expect reader to throw exception because file is not opened
+    EXPECT_ANY_THROW(reader.read());
+}
+
+TEST(MmapCsvReader_TestSuite, FailedRead_IfFileIsEmpty)
+{
+    MmapCsvReader reader;
+    const char* filename = "test.csv";
+
+    // create file with ofstream & close it
+    std::ofstream writer(filename);
+    writer.close();
+
+    // open the file with reader
+    reader.open(filename);
+
+    // expect reader not to throw exception & to return false, because file is empty
+    EXPECT_NO_THROW(EXPECT_FALSE(reader.read()));
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(MmapCsvReader_TestSuite, SucceedRead_SameLinesAsCsvReader)
+{
+    MmapCsvReader mmapReader;
+    CsvReader csvReader;
+    const char* filename = "test.csv";
+    std::string mmapOutput;
+    std::string csvOutput;
+
+    // create file with ofstream, write lines (last one without newline) & close it
+    std::ofstream writer(filename);
+    writer << "TEST; \t TEST; \t TEST; #123\n";
+    writer << "\n";
+    writer << "TEST; \t TEST; \t TEST; #312\r\n";
+    writer << "TEST; \t TEST; \t TEST; #231";
+    writer.close();
+
+    // open the file with both readers
+    mmapReader.open(filename);
+    csvReader.open(filename);
+
+    // expect readers to read the same lines
+    while (csvReader.read(&csvOutput))
+    {
+        EXPECT_TRUE(mmapReader.read(&mmapOutput));
+        EXPECT_EQ(csvOutput, mmapOutput);
+    }
+    EXPECT_FALSE(mmapReader.read());
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(MmapCsvReader_TestSuite, SucceedExtract_MultipleRows)
+{
+    MmapCsvReader reader;
+    const char* filename = "test.csv";
+
+    reader.setNumOfCols(4);
+
+    // create file with ofstream, write data & close it
+    std::ofstream writer(filename);
+    writer << "555333;\t5.5;\t\t3.300452;\tHello world\r\n";
+    writer << "111222;\t1.25;\t\t0.5;\tGood bye\n";
+    writer.close();
+
+    // open the file with reader
+    reader.open(filename);
+
+    // expect reader to read good values from both rows
+    ASSERT_TRUE(reader.read());
+    EXPECT_EQ(reader.extractULongLong(), 555333);
+    EXPECT_EQ(reader.extractFloat(), 5.5f);
+    EXPECT_EQ(reader.extractDouble(), 3.300452);
+    EXPECT_EQ(reader.extractString(), "Hello world");
+
+    ASSERT_TRUE(reader.read());
+    EXPECT_EQ(reader.extractULongLong(), 111222);
+    EXPECT_EQ(reader.extractFloat(), 1.25f);
+    EXPECT_EQ(reader.extractDouble(), 0.5);
+    EXPECT_EQ(reader.extractString(), "Good bye");
+
+    EXPECT_FALSE(reader.read());
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(MmapCsvReader_TestSuite, SucceedDeserialization_Items)
+{
+    Items items;
+    std::shared_ptr<MmapCsvReader> reader(new MmapCsvReader);
+    const char* filename = "test.csv";
+    const Item comparingItem = {"Coca-Cola", Money::parse("1.21"), Percent::parse("3.5")};
+
+    // create file with ofstream & write some data
+    std::ofstream writer(filename);
+    writer << "4432441693730;\tCoca-Cola;\t\t1.21;\t\t3.5\n";
+    writer << "6348785294219;\tAwesome Apple;\t\t0.69;\t\t8.8\n";
+    writer.close();
+
+    // open file with reader
+    reader->open(filename);
+    EXPECT_NO_THROW(items << reader);
+
+    // compare deserialized item with initial
+    ASSERT_TRUE(items.getItem(4432441693730));
+    EXPECT_EQ(*items.getItem(4432441693730), comparingItem);
+    EXPECT_TRUE(items.getItem(6348785294219));
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
@@ -0,0 +1,227 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <regex>
+#include <stdexcept>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <file_reader/CsvReader.h>
+#include <file_reader/NumberParser.h>
+
+/**
+ * @brief Outcome of cell extraction (converted value or thrown exception)
+ */
+struct ExtractOutcome
+{
+    /**
+     * @brief exception type ("" if value is converted)
+     */
+    std::string exception;
+    /**
+     * @brief exception message
+     */
+    std::string message;
+    /**
+     * @brief converted value bits
+     */
+    uint64_t bits = 0;
+
+    bool operator==(const ExtractOutcome& other) const
+    {
+        return exception == other.exception && message == other.message && bits == other.bits;
+    }
+};
+
+/**
+ * @brief Prints outcome within failed expectations
+ */
+static std::ostream& operator<<(std::ostream& os, const ExtractOutcome& outcome)
+{
+    return os << "{" << outcome.exception << ", \"" << outcome.message << "\", " << outcome.bits << "}";
+}
+
+/**
+ * @brief Copies bits of converted value
+ */
+template <typename T>
+static uint64_t toBits(T value)
+{
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+/**
+ * @brief Runs extraction and records its outcome
+ */
+template <typename Function>
+static ExtractOutcome runExtraction(Function extract)
+{
+    ExtractOutcome outcome;
+    try
+    {
+        outcome.bits = extract();
+    }
+    catch (const std::out_of_range& e)
+    {
+        outcome.exception = "out_of_range";
+        outcome.message = e.what();
+    }
+    catch (const std::invalid_argument& e)
+    {
+        outcome.exception = "invalid_argument";
+        outcome.message = e.what();
+    }
+    catch (const std::runtime_error& e)
+    {
+        outcome.exception = "runtime_error";
+        outcome.message = e.what();
+    }
+    return outcome;
+}
+
+/**
+ * @brief Reference (former) implementation: regex validation followed by std::sto* conversion
+ */
+static ExtractOutcome legacyExtract(const std::string& cell, char type)
+{
+    static const std::regex positiveNumReg(R"(^[0-9]+$)");
+    static const std::regex positiveDecReg(R"(^[+]?[0-9]*(?:\.[0-9]*)?$)");
+
+    return runExtraction([&]() -> uint64_t
+    {
+        if (type == 'u')
+        {
+            if (!std::regex_match(cell, positiveNumReg))
+            {
+                throw std::runtime_error('"' + cell + '"' + " is not a natural number.");
+            }
+            return toBits(std::stoull(cell));
+        }
+        if (!std::regex_match(cell, positiveDecReg))
+        {
+            throw std::runtime_error('"' + cell + '"' + " is not a decimal number.");
+        }
+        return (type == 'd') ? toBits(std::stod(cell)) : toBits(std::stof(cell));
+    });
+}
+
+/**
+ * @brief cells which shall be accepted & rejected the same way by both paths
+ */
+static const std::vector<std::string> cNumberCorpus =
+{
+    // natural numbers & EAN 13
+    "0", "7", "42", "0042", "555333", "4432441693730", "5720092407427",
+    "18446744073709551615", "18446744073709551616", "99999999999999999999999",
+    // decimal numbers
+    "1.21", "3.5", "8.8", "12", "223.21", "3.300452", "5.500000", "0.1", "0.30000000000000004",
+    "123456789.123456789", "+5.5", "+12", "5.", ".5", "+.5", "0.", "00.0100",
+    // matching format, but without digits
+    "", "+", ".", "+.",
+    // bad format
+    "-5", "+-5", "++5", "5.5.5", "1e5", "1E5", "inf", "nan", "INF", "0x1F", "5,5", "abc", "5a", "a5",
+    "12 3", "1.7976931348623157e308", "SH1.2f1fX", "33H1F5.0", ".e", "..5", "5..",
+    // out of float/double range (overflow & underflow)
+    "1" + std::string(40, '0'), "340282356779733661637539395458142568448",
+    "1" + std::string(400, '0'), "0." + std::string(400, '0') + "1",
+    "0." + std::string(39, '0') + "1", "0." + std::string(320, '0') + "1",
+};
+
+TEST(NumberParser_TestSuite, SameOutcomeAsRegexAndStoConversion)
+{
+    CsvReader reader;
+    const char* filename = "test.csv";
+
+    reader.setNumOfCols(1);
+
+    // create file with ofstream, write each cell padded with tabs & carriage return
+    std::ofstream writer(filename);
+    for (const std::string& cell : cNumberCorpus)
+    {
+        writer << "\t" << cell << "\r\n";
+    }
+    writer.close();
+
+    // each cell is extracted in every format from its own pass through the file
+    for (const char type : {'u', 'd', 'f'})
+    {
+        reader.open(filename);
+        for (const std::string& cell : cNumberCorpus)
+        {
+            ASSERT_TRUE(reader.read());
+            const ExtractOutcome outcome = runExtraction([&]() -> uint64_t
+            {
+                if (type == 'u')
+                {
+                    return toBits(reader.extractULongLong());
+                }
+                return (type == 'd') ? toBits(reader.extractDouble()) : toBits(reader.extractFloat());
+            });
+            EXPECT_EQ(outcome, legacyExtract(cell, type)) << "cell \"" << cell << "\" type " << type;
+        }
+    }
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(NumberParser_TestSuite, ParseStatusOfCells)
+{
+    uint64_t natural;
+    double decimal;
+
+    EXPECT_EQ(parseNatural("4432441693730", natural), ParseStatus::Ok);
+    EXPECT_EQ(natural, 4432441693730ULL);
+    EXPECT_EQ(parseNatural("", natural), ParseStatus::NotNumber);
+    EXPECT_EQ(parseNatural("+1", natural), ParseStatus::NotNumber);
+    EXPECT_EQ(parseNatural("18446744073709551616", natural), ParseStatus::OutOfRange);
+
+    EXPECT_EQ(parseDecimal("+1.25", decimal), ParseStatus::Ok);
+    EXPECT_EQ(decimal, 1.25);
+    EXPECT_EQ(parseDecimal("+.", decimal), ParseStatus::NoConversion);
+    EXPECT_EQ(parseDecimal("1.2.3", decimal), ParseStatus::NotNumber);
+    EXPECT_EQ(parseDecimal("1" + std::string(400, '0'), decimal), ParseStatus::OutOfRange);
+}
+
+TEST(NumberParser_TestSuite, ParseFixedPointOfCells)
+{
+    int64_t value;
+    double decimal;
+
+    EXPECT_EQ(parseFixedPoint("1.21", 2, value), ParseStatus::Ok);
+    EXPECT_EQ(value, 121);
+    EXPECT_EQ(parseFixedPoint("+3.", 2, value), ParseStatus::Ok);
+    EXPECT_EQ(value, 300);
+    EXPECT_EQ(parseFixedPoint(".5", 3, value), ParseStatus::Ok);
+    EXPECT_EQ(value, 500);
+    EXPECT_EQ(parseFixedPoint("007", 0, value), ParseStatus::Ok);
+    EXPECT_EQ(value, 7);
+
+    // dropped fraction digits are rounded half up
+    EXPECT_EQ(parseFixedPoint("112.453", 2, value), ParseStatus::Ok);
+    EXPECT_EQ(value, 11245);
+    EXPECT_EQ(parseFixedPoint("1.235", 2, value), ParseStatus::Ok);
+    EXPECT_EQ(value, 124);
+    EXPECT_EQ(parseFixedPoint("0.9999", 2, value), ParseStatus::Ok);
+    EXPECT_EQ(value, 100);
+
+    // range of int64_t
+    EXPECT_EQ(parseFixedPoint("92233720368547758.07", 2, value), ParseStatus::Ok);
+    EXPECT_EQ(value, INT64_MAX);
+    EXPECT_EQ(parseFixedPoint("92233720368547758.08", 2, value), ParseStatus::OutOfRange);
+    EXPECT_EQ(parseFixedPoint("92233720368547758.075", 2, value), ParseStatus::OutOfRange);
+    EXPECT_EQ(parseFixedPoint("1" + std::string(400, '0'), 2, value), ParseStatus::OutOfRange);
+
+    // the same format as decimal numbers
+    for (const std::string cell : {"", "+", ".", "+.", "-1", "1.2.3", "1e5", "inf", " 1", "1,5", "0x10", "++1"})
+    {
+        EXPECT_EQ(parseFixedPoint(cell, 2, value), parseDecimal(cell, decimal)) << "cell \"" << cell << "\"";
+    }
+}
@@ -0,0 +1,400 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/Items.h>
+#include <objects/Discounts.h>
+#include <objects/Orders.h>
+#include <objects/OrderBatch.h>
+#include <objects/ProcessedOrders.h>
+#include <file_reader/CsvReader.h>
+
+#include "TestUtils.h"
+
+TEST(OrderBatch_TestSuite, SucceedListOrderFiles_Directory)
+{
+    const std::filesystem::path directory = "test_batch_dir";
+    std::filesystem::create_directory(directory);
+    for (const char* filename : {"order_2.csv", "order_1.csv", "notes.txt", "order_10.csv"})
+    {
+        std::ofstream(directory / filename) << "5720092407427;1";
+    }
+
+    const std::vector<std::string> filenames = OrderBatch::listOrderFiles(directory.string());
+
+    // only CSV files, sorted by name
+    ASSERT_EQ(filenames.size(), 3u);
+    EXPECT_EQ(filenames[0], (directory / "order_1.csv").string());
+    EXPECT_EQ(filenames[1], (directory / "order_10.csv").string());
+    EXPECT_EQ(filenames[2], (directory / "order_2.csv").string());
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(OrderBatch_TestSuite, SucceedListOrderFiles_Manifest)
+{
+    const std::filesystem::path directory = "test_batch_dir";
+    std::filesystem::create_directory(directory);
+    std::ofstream(directory / "manifest.txt") << "order_b.csv\n\n  order_a.csv \r\n/tmp/order_c.csv\n";
+
+    const std::vector<std::string> filenames = OrderBatch::listOrderFiles((directory / "manifest.txt").string());
+
+    // order of manifest is kept, relative files are within directory of manifest
+    ASSERT_EQ(filenames.size(), 3u);
+    EXPECT_EQ(filenames[0], (directory / "order_b.csv").string());
+    EXPECT_EQ(filenames[1], (directory / "order_a.csv").string());
+    EXPECT_EQ(filenames[2], "/tmp/order_c.csv");
+
+    std::filesystem::remove_all(directory);
+    EXPECT_THROW(OrderBatch::listOrderFiles((directory / "manifest.txt").string()), std::runtime_error);
+}
+
+TEST(OrderBatch_TestSuite, SucceedProcess_SameAsSequentialOrders)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* discount_filename = "test_discount.csv";
+    const size_t numOfOrders = 20;
+    std::vector<std::string> order_filenames;
+    std::ofstream writer;
+    Items item;
+    Discounts discount;
+
+    // create files with ofstream & write some data, the 5th order contains unknown item
+    writer.open(item_filename);
+    for (int i = 0; i < 100; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";" << i << ".25;3.5\n";
+    }
+    writer.close();
+    writer.open(discount_filename);
+    writer << "5720092400001;15\n5720092400007;30";
+    writer.close();
+    for (size_t i = 0; i < numOfOrders; i++)
+    {
+        order_filenames.push_back("test_batch_order_" + std::to_string(i) + ".csv");
+        writer.open(order_filenames.back());
+        for (size_t j = 0; j <= i * 100; j++)
+        {
+            writer << 5720092400000 + (i + j) % 100 << ";" << j % 3 + 1 << "\n";
+        }
+        if (i == 4)
+        {
+            writer << "5720092499999;1\n";
+        }
+        writer.close();
+    }
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(discount_filename);
+    ASSERT_NO_THROW(discount << reader);
+
+    OrderBatch batch(item, &discount);
+    const std::vector<OrderBatchResult> results = batch.process(order_filenames, 4);
+
+    ASSERT_EQ(results.size(), numOfOrders);
+    for (size_t i = 0; i < numOfOrders; i++)
+    {
+        // numbers follow order of files
+        EXPECT_EQ(results[i].orderFilename, order_filenames[i]);
+        EXPECT_EQ(results[i].orderNum, results[0].orderNum + i);
+        if (i == 4)
+        {
+            EXPECT_FALSE(results[i].error.empty());
+            EXPECT_TRUE(results[i].billFilename.empty());
+            continue;
+        }
+        ASSERT_TRUE(results[i].error.empty()) << results[i].error;
+        EXPECT_EQ(results[i].numOfRows, i * 100 + 1);
+
+        // bill matches the one of sequential processing (apart from order number)
+        ProcessedOrders proc;
+        reader->open(order_filenames[i]);
+        ASSERT_NO_THROW(proc.processOrder(*reader, &item, &discount));
+        EXPECT_EQ(results[i].total, proc.getTotal());
+        writer.open("test_bill.txt");
+        proc >> writer;
+        writer.close();
+
+        const std::string bill = readFile(results[i].billFilename);
+        const std::string sequential_bill = readFile("test_bill.txt");
+        EXPECT_EQ(bill.substr(0, bill.find('\n')), "Order #" + std::to_string(results[i].orderNum));
+        EXPECT_EQ(bill.substr(bill.find('\n')), sequential_bill.substr(sequential_bill.find('\n')));
+        std::remove(results[i].billFilename.c_str());
+    }
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(discount_filename);
+    std::remove("test_bill.txt");
+    for (const std::string& filename : order_filenames)
+    {
+        std::remove(filename.c_str());
+    }
+}
+
+TEST(OrderBatch_TestSuite, SucceedReserveOrderNums_UniqueBetweenThreads)
+{
+    const size_t numOfThreads = 4;
+    const size_t numOfReservations = 10000;
+    std::vector<std::vector<size_t>> numbers(numOfThreads);
+    std::vector<std::thread> threads;
+    std::set<size_t> unique;
+
+    for (size_t i = 0; i < numOfThreads; i++)
+    {
+        threads.emplace_back([&numbers, i]()
+        {
+            for (size_t j = 0; j < numOfReservations; j++)
+            {
+                numbers[i].push_back(Orders::reserveOrderNums(1));
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const std::vector<size_t>& reserved : numbers)
+    {
+        unique.insert(reserved.begin(), reserved.end());
+    }
+    EXPECT_EQ(unique.size(), numOfThreads * numOfReservations);
+}
+
+TEST(OrderBatch_TestSuite, SucceedProcess_BigOrdersSplitIntoSubtasks)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const size_t numOfItems = 20000;
+    std::vector<std::string> order_filenames;
+    std::ofstream writer;
+    Items item;
+
+    // create files with ofstream, two giant orders (repeated items & malformed rows) among small ones
+    writer.open(item_filename);
+    for (size_t i = 0; i < numOfItems; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";" << i % 997 << ".37;" << i % 25 << "\n";
+    }
+    writer.close();
+    for (size_t i = 0; i < 8; i++)
+    {
+        const size_t numOfLines = (i == 1 || i == 6) ? 20000 : i + 3;
+        order_filenames.push_back("test_batch_order_" + std::to_string(i) + ".csv");
+        writer.open(order_filenames.back());
+        for (size_t j = 0; j < numOfLines; j++)
+        {
+            if (j % 5000 == 4999)
+            {
+                writer << "malformed;1\n";
+                continue;
+            }
+            writer << 5720092400000 + (j * 7919 + i) % numOfItems << ";" << j % 5 << ".125\n";
+        }
+        writer.close();
+    }
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+
+    OrderBatch batch(item);
+    batch.setErrorBudget(10);
+    const std::vector<OrderBatchResult> results = batch.process(order_filenames, 4);
+
+    ASSERT_EQ(results.size(), order_filenames.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        ASSERT_TRUE(results[i].error.empty()) << results[i].error;
+
+        // sequential fused processing of the same file
+        ProcessedOrders proc;
+        proc.setErrorBudget(10);
+        reader->open(order_filenames[i]);
+        ASSERT_NO_THROW(proc.processOrder(*reader, &item));
+        EXPECT_EQ(results[i].total, proc.getTotal());
+        EXPECT_EQ(results[i].numOfRows, proc.getNumOfRows());
+
+        // skipped rows keep their numbers within whole file
+        ASSERT_EQ(results[i].skippedRows.size(), proc.getErrorReport().getErrors().size());
+        for (size_t j = 0; j < results[i].skippedRows.size(); j++)
+        {
+            EXPECT_EQ(results[i].skippedRows[j].row, proc.getErrorReport().getErrors()[j].row);
+        }
+
+        writer.open("test_bill.txt");
+        proc >> writer;
+        writer.close();
+        const std::string bill = readFile(results[i].billFilename);
+        const std::string sequential_bill = readFile("test_bill.txt");
+        EXPECT_EQ(bill.substr(bill.find('\n')), sequential_bill.substr(sequential_bill.find('\n')));
+        std::remove(results[i].billFilename.c_str());
+    }
+    EXPECT_EQ(results[1].skippedRows.size(), 4u);
+    EXPECT_EQ(results[1].skippedRows[0].row, 5000u);
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove("test_bill.txt");
+    for (const std::string& filename : order_filenames)
+    {
+        std::remove(filename.c_str());
+    }
+}
+
+TEST(OrderBatch_TestSuite, SucceedLoadParallel_SameAsSequentialOrders)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    std::ofstream writer;
+    Items item;
+    Orders sequential;
+    Orders parallel;
+    ProcessedOrders sequential_proc;
+    ProcessedOrders parallel_proc;
+
+    // create files with ofstream, every item is ordered many times across whole file
+    writer.open(item_filename);
+    for (int i = 0; i < 1000; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";" << i << ".99;3.5\n";
+    }
+    writer.close();
+    writer.open(order_filename);
+    for (int i = 0; i < 100000; i++)
+    {
+        writer << 5720092400000 + (i * 31) % 1000 << ";" << i % 4 << ".5\n";
+    }
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(order_filename);
+    ASSERT_NO_THROW(sequential << reader);
+    ASSERT_NO_THROW(parallel.loadParallel(order_filename, 4));
+
+    ASSERT_NO_THROW(sequential_proc.processOrder(&sequential, &item));
+    ASSERT_NO_THROW(parallel_proc.processOrder(&parallel, &item));
+    EXPECT_EQ(parallel_proc.getNumOfRows(), sequential_proc.getNumOfRows());
+    EXPECT_EQ(parallel_proc.getTotal(), sequential_proc.getTotal());
+    for (int i = 0; i < 1000; i++)
+    {
+        ASSERT_NE(parallel_proc.getProcessedOrder(5720092400000 + i), nullptr);
+        EXPECT_EQ(*parallel_proc.getProcessedOrder(5720092400000 + i), *sequential_proc.getProcessedOrder(5720092400000 + i));
+    }
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+}
+
+TEST(OrderBatch_TestSuite, SucceedProcessAsync_SameAsProcess)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* discount_filename = "test_discount.csv";
+    const size_t numOfOrders = 30;
+    std::vector<std::string> order_filenames;
+    std::ofstream writer;
+    Items item;
+    Discounts discount;
+
+    // create files with ofstream & write some data, the 5th order contains unknown item, the 9th one malformed row
+    writer.open(item_filename);
+    for (int i = 0; i < 100; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";" << i << ".25;3.5\n";
+    }
+    writer.close();
+    writer.open(discount_filename);
+    writer << "5720092400001;15\n5720092400007;30";
+    writer.close();
+    for (size_t i = 0; i < numOfOrders; i++)
+    {
+        order_filenames.push_back("test_async_order_" + std::to_string(i) + ".csv");
+        writer.open(order_filenames.back());
+        for (size_t j = 0; j <= i * 100; j++)
+        {
+            writer << 5720092400000 + (i + j) % 100 << ";" << j % 3 + 1 << "." << j % 1000 << "\n";
+        }
+        if (i == 4)
+        {
+            writer << "5720092499999;1\n";
+        }
+        if (i == 8)
+        {
+            writer << "malformed;1\n";
+        }
+        writer.close();
+    }
+    order_filenames.push_back("test_async_missing.csv");
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(discount_filename);
+    ASSERT_NO_THROW(discount << reader);
+
+    // bills of synchronous I/O are the reference
+    OrderBatch batch(item, &discount);
+    batch.setErrorBudget(1);
+    const std::vector<OrderBatchResult> batch_results = batch.process(order_filenames, 2);
+    std::vector<std::string> batch_bills;
+    for (const OrderBatchResult& result : batch_results)
+    {
+        batch_bills.push_back(result.billFilename.empty() ? "" : readFile(result.billFilename));
+        std::remove(result.billFilename.c_str());
+    }
+
+    for (const AsyncIo::Backend backend : {AsyncIo::Backend::Auto, AsyncIo::Backend::ThreadPool})
+    {
+        const std::vector<OrderBatchResult> results = batch.processAsync(order_filenames, 2, 4, backend);
+
+        ASSERT_EQ(results.size(), order_filenames.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            // numbers follow order of files
+            EXPECT_EQ(results[i].orderFilename, order_filenames[i]);
+            EXPECT_EQ(results[i].orderNum, results[0].orderNum + i);
+            EXPECT_EQ(results[i].error, batch_results[i].error);
+            if (!results[i].error.empty())
+            {
+                EXPECT_TRUE(results[i].billFilename.empty());
+                continue;
+            }
+            EXPECT_EQ(results[i].numOfRows, batch_results[i].numOfRows);
+            EXPECT_EQ(results[i].total, batch_results[i].total);
+            ASSERT_EQ(results[i].skippedRows.size(), batch_results[i].skippedRows.size());
+
+            // bill matches the one of synchronous I/O (apart from order number)
+            const std::string bill = readFile(results[i].billFilename);
+            EXPECT_EQ(bill.substr(0, bill.find('\n')), "Order #" + std::to_string(results[i].orderNum));
+            EXPECT_EQ(bill.substr(bill.find('\n')), batch_bills[i].substr(batch_bills[i].find('\n')));
+            std::remove(results[i].billFilename.c_str());
+        }
+        EXPECT_FALSE(results[4].error.empty());
+        EXPECT_EQ(results[8].skippedRows.size(), 1u);
+        EXPECT_FALSE(results.back().error.empty());
+    }
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(discount_filename);
+    for (const std::string& filename : order_filenames)
+    {
+        std::remove(filename.c_str());
+    }
+}
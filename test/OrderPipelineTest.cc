@@ -0,0 +1,176 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/Items.h>
+#include <objects/Discounts.h>
+#include <objects/OrderBatch.h>
+#include <objects/OrderPipeline.h>
+#include <file_reader/CsvReader.h>
+
+#include "TestUtils.h"
+
+TEST(OrderPipeline_TestSuite, SucceedProcess_SameAsOrderBatch)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* discount_filename = "test_discount.csv";
+    const size_t numOfOrders = 30;
+    std::vector<std::string> order_filenames;
+    std::ofstream writer;
+    Items item;
+    Discounts discount;
+
+    // create files with ofstream & write some data, the 5th order contains unknown item, the 9th one malformed row
+    writer.open(item_filename);
+    for (int i = 0; i < 100; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";" << i << ".25;3.5\n";
+    }
+    writer.close();
+    writer.open(discount_filename);
+    writer << "5720092400001;15\n5720092400007;30";
+    writer.close();
+    for (size_t i = 0; i < numOfOrders; i++)
+    {
+        order_filenames.push_back("test_pipeline_order_" + std::to_string(i) + ".csv");
+        writer.open(order_filenames.back());
+        for (size_t j = 0; j <= i * 50; j++)
+        {
+            writer << 5720092400000 + (i + j) % 100 << ";" << j % 3 + 1 << "." << j % 1000 << "\n";
+        }
+        if (i == 4)
+        {
+            writer << "5720092499999;1\n";
+        }
+        if (i == 8)
+        {
+            writer << "malformed;1\n";
+        }
+        writer.close();
+    }
+    order_filenames.push_back("test_pipeline_missing.csv");
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(discount_filename);
+    ASSERT_NO_THROW(discount << reader);
+
+    // bills of batch are the reference
+    OrderBatch batch(item, &discount);
+    batch.setErrorBudget(1);
+    const std::vector<OrderBatchResult> batch_results = batch.process(order_filenames, 2);
+    std::vector<std::string> batch_bills;
+    for (const OrderBatchResult& result : batch_results)
+    {
+        batch_bills.push_back(result.billFilename.empty() ? "" : readFile(result.billFilename));
+        std::remove(result.billFilename.c_str());
+    }
+
+    OrderPipeline pipeline(item, &discount);
+    pipeline.setErrorBudget(1);
+    for (const OrderPipelineConfig& config : {OrderPipelineConfig{1, 1, 1, 1}, OrderPipelineConfig{2, 3, 2, 4}, OrderPipelineConfig{3, 1, 1, 2}})
+    {
+        const std::vector<OrderBatchResult> results = pipeline.process(order_filenames, config);
+
+        ASSERT_EQ(results.size(), order_filenames.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            // numbers follow order of files
+            EXPECT_EQ(results[i].orderFilename, order_filenames[i]);
+            EXPECT_EQ(results[i].orderNum, results[0].orderNum + i);
+            EXPECT_EQ(results[i].error.empty(), batch_results[i].error.empty()) << results[i].error;
+            if (!results[i].error.empty())
+            {
+                EXPECT_TRUE(results[i].billFilename.empty());
+                continue;
+            }
+            EXPECT_EQ(results[i].numOfRows, batch_results[i].numOfRows);
+            EXPECT_EQ(results[i].total, batch_results[i].total);
+            ASSERT_EQ(results[i].skippedRows.size(), batch_results[i].skippedRows.size());
+            for (size_t j = 0; j < results[i].skippedRows.size(); j++)
+            {
+                EXPECT_EQ(results[i].skippedRows[j].row, batch_results[i].skippedRows[j].row);
+            }
+
+            // bill matches the one of batch (apart from order number)
+            const std::string bill = readFile(results[i].billFilename);
+            EXPECT_EQ(bill.substr(0, bill.find('\n')), "Order #" + std::to_string(results[i].orderNum));
+            EXPECT_EQ(bill.substr(bill.find('\n')), batch_bills[i].substr(batch_bills[i].find('\n')));
+            std::remove(results[i].billFilename.c_str());
+        }
+        EXPECT_FALSE(results[4].error.empty());
+        EXPECT_EQ(results[8].skippedRows.size(), 1u);
+        EXPECT_FALSE(results.back().error.empty());
+
+        // every stage is measured, failed orders leave the pipeline early
+        const std::vector<PipelineStageStats>& stats = pipeline.getStageStats();
+        ASSERT_EQ(stats.size(), 3u);
+        EXPECT_EQ(stats[0].name, "parse");
+        EXPECT_EQ(stats[0].numOfThreads, config.parseThreads);
+        EXPECT_EQ(stats[0].numOfOrders, order_filenames.size());
+        EXPECT_EQ(stats[1].numOfOrders, order_filenames.size() - 1);
+        EXPECT_EQ(stats[2].numOfOrders, order_filenames.size() - 2);
+        for (const PipelineStageStats& stage : stats)
+        {
+            EXPECT_LE(stage.maxQueueDepth, stage.queueCapacity);
+            EXPECT_LE(stage.meanQueueDepth, static_cast<double>(stage.maxQueueDepth));
+        }
+        EXPECT_EQ(stats[1].queueCapacity, config.queueCapacity);
+    }
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(discount_filename);
+    for (const std::string& filename : order_filenames)
+    {
+        std::remove(filename.c_str());
+    }
+}
+
+TEST(OrderPipeline_TestSuite, SucceedProcess_SingleOrderFindsEmptyQueues)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_pipeline_order.csv";
+    std::ofstream writer;
+    Items item;
+
+    // create files with ofstream & write some data
+    writer.open(item_filename);
+    writer << "5720092400000;Item;1.25;3.5\n";
+    writer.close();
+    writer.open(order_filename);
+    writer << "5720092400000;2\n";
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+
+    // the only order is pushed into empty queues
+    OrderPipeline pipeline(item);
+    const std::vector<OrderBatchResult> results = pipeline.process({order_filename}, OrderPipelineConfig{1, 1, 1, 4});
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(results[0].error.empty()) << results[0].error;
+
+    const std::vector<PipelineStageStats>& stats = pipeline.getStageStats();
+    ASSERT_EQ(stats.size(), 3u);
+    for (size_t stage = 1; stage < stats.size(); stage++)
+    {
+        EXPECT_EQ(stats[stage].maxQueueDepth, 0u);
+        EXPECT_EQ(stats[stage].meanQueueDepth, 0);
+    }
+
+    // make sure that file has been deleted
+    std::remove(results[0].billFilename.c_str());
+    std::remove(item_filename);
+    std::remove(order_filename);
+}
@@ -0,0 +1,113 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <memory>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/Items.h>
+#include <objects/Discounts.h>
+#include <objects/Orders.h>
+#include <objects/PriceTable.h>
+#include <objects/ProcessedOrders.h>
+#include <file_reader/CsvReader.h>
+
+/**
+ * @brief Writes content into file & deserializes objects from it
+ */
+static void load(IObjects& objects, const char* filename, const std::string& content)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    std::ofstream writer(filename);
+
+    writer << content;
+    writer.close();
+    reader->open(filename);
+    objects << reader;
+    std::remove(filename);
+}
+
+TEST(PriceTable_TestSuite, Build_JoinsItemsWithDiscounts)
+{
+    Items items;
+    Discounts discounts;
+    PriceTable table;
+
+    load(items, "test_item.csv", "5720092407427;Fanta;1.21;3.5\n5720092407428;Coca-Cola;2.50;8\n");
+    load(discounts, "test_discount.csv", "5720092407427;5.12\n4432441693730;10\n");
+    table.build(items, &discounts);
+
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_TRUE(table.isBuiltFrom(items, &discounts));
+    EXPECT_FALSE(table.isBuiltFrom(items, nullptr));
+
+    // item with discount
+    const PricedItem* fanta = table.find(5720092407427);
+    ASSERT_NE(fanta, nullptr);
+    EXPECT_EQ(fanta->name, "Fanta");
+    EXPECT_EQ(fanta->taxPercent, Percent::parse("3.5"));
+    EXPECT_EQ(fanta->discountPercent, Percent::parse("5.12"));
+    // 1.21 * 1.035 * 0.9488 = 1.188...
+    EXPECT_EQ(fanta->unitPrice, Money::parse("1.19"));
+
+    // item without discount
+    const PricedItem* cola = table.find(5720092407428);
+    ASSERT_NE(cola, nullptr);
+    EXPECT_EQ(cola->discountPercent, Percent());
+    EXPECT_EQ(cola->unitPrice, Money::parse("2.70"));
+
+    // discount without item isn't priced
+    EXPECT_EQ(table.find(4432441693730), nullptr);
+}
+
+TEST(PriceTable_TestSuite, Reload_MakesTableStale)
+{
+    Items items;
+    Discounts discounts;
+    PriceTable table;
+
+    load(items, "test_item.csv", "5720092407427;Fanta;1.21;3.5\n");
+    load(discounts, "test_discount.csv", "5720092407427;5.12\n");
+    table.build(items, &discounts);
+    ASSERT_TRUE(table.isBuiltFrom(items, &discounts));
+
+    // reload of either input invalidates table
+    load(discounts, "test_discount.csv", "5720092407427;10\n");
+    EXPECT_FALSE(table.isBuiltFrom(items, &discounts));
+    table.build(items, &discounts);
+    EXPECT_TRUE(table.isBuiltFrom(items, &discounts));
+
+    load(items, "test_item.csv", "5720092407427;Fanta;1.50;3.5\n");
+    EXPECT_FALSE(table.isBuiltFrom(items, &discounts));
+
+    // other objects with the same content are other inputs
+    Items otherItems;
+    EXPECT_FALSE(table.isBuiltFrom(otherItems, &discounts));
+}
+
+TEST(PriceTable_TestSuite, ProcessOrder_UsesReloadedDiscounts)
+{
+    Items items;
+    Discounts discounts;
+    Orders orders;
+    ProcessedOrders proc;
+
+    load(items, "test_item.csv", "5720092407427;Fanta;1.21;3.5\n");
+    load(discounts, "test_discount.csv", "5720092407427;5.12\n");
+    load(orders, "test_order.csv", "5720092407427;2\n");
+
+    proc.processOrder(&orders, &items, &discounts);
+    ASSERT_NE(proc.getProcessedOrder("Fanta"), nullptr);
+    EXPECT_EQ(proc.getProcessedOrder("Fanta")->discountPercent, Percent::parse("5.12"));
+
+    // processed orders shall see reloaded discounts
+    load(discounts, "test_discount.csv", "5720092407427;10\n");
+    proc.processOrder(&orders, &items, &discounts);
+    ASSERT_NE(proc.getProcessedOrder("Fanta"), nullptr);
+    EXPECT_EQ(proc.getProcessedOrder("Fanta")->discountPercent, Percent::parse("10"));
+    // 1.21 * 1.035 * 0.9 = 1.127...
+    EXPECT_EQ(proc.getProcessedOrder("Fanta")->unitPrice, Money::parse("1.13"));
+}
@@ -0,0 +1,173 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/FixedPoint.h>
+#include <objects/Items.h>
+#include <objects/Orders.h>
+#include <objects/PricingKernel.h>
+#include <objects/ProcessedOrders.h>
+#include <file_reader/CsvReader.h>
+
+/**
+ * @brief every instruction set, unsupported one falls back to supported one, which is also fine to check
+ */
+static const PricingKernel::Isa cIsas[] = {PricingKernel::Isa::Scalar, PricingKernel::Isa::Avx2, PricingKernel::Isa::Avx512};
+
+/**
+ * @brief Reference pricing: calculatePrice of every line
+ */
+static int64_t referencePriceLines(const std::vector<int64_t>& unitPrices, const std::vector<int64_t>& quantities, std::vector<int64_t>& finalPrices)
+{
+    int64_t total = 0;
+    finalPrices.resize(unitPrices.size());
+    for (size_t i = 0; i < unitPrices.size(); i++)
+    {
+        finalPrices[i] = calculatePrice(Money::fromMinorUnits(unitPrices[i]), Quantity::fromMinorUnits(quantities[i])).getMinorUnits();
+        total += finalPrices[i];
+    }
+    return total;
+}
+
+TEST(PricingKernel_TestSuite, EveryIsaMatchesReference)
+{
+    const PricingKernel::Isa initialIsa = PricingKernel::getIsa();
+    std::mt19937_64 generator(2022);
+
+    for (const PricingKernel::Isa isa : cIsas)
+    {
+        PricingKernel::setIsa(isa);
+
+        for (size_t count : {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 63, 1000})
+        {
+            std::vector<int64_t> unitPrices(count);
+            std::vector<int64_t> quantities(count);
+            std::vector<int64_t> finalPrices(count);
+            std::vector<int64_t> referenceFinalPrices;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                // mostly prices of vector lanes, some lanes beyond 2^30 or negative (discount over 100 %)
+                switch (generator() % 8)
+                {
+                case 0:
+                    unitPrices[i] = static_cast<int64_t>(generator() % (1ULL << 40));
+                    break;
+                case 1:
+                    unitPrices[i] = -static_cast<int64_t>(generator() % 100000);
+                    break;
+                case 2:
+                    unitPrices[i] = (1LL << 30) - 1;
+                    break;
+                default:
+                    unitPrices[i] = static_cast<int64_t>(generator() % 100000);
+                    break;
+                }
+                quantities[i] = (generator() % 8) ? static_cast<int64_t>(generator() % (1ULL << 30)) : static_cast<int64_t>(generator() % 5000);
+            }
+
+            const int64_t referenceTotal = referencePriceLines(unitPrices, quantities, referenceFinalPrices);
+            ASSERT_EQ(PricingKernel::priceLines(unitPrices.data(), quantities.data(), finalPrices.data(), count), referenceTotal);
+            ASSERT_EQ(finalPrices, referenceFinalPrices);
+        }
+    }
+
+    PricingKernel::setIsa(initialIsa);
+}
+
+TEST(PricingKernel_TestSuite, EveryIsaRoundsHalfUp)
+{
+    const PricingKernel::Isa initialIsa = PricingKernel::getIsa();
+    std::vector<int64_t> unitPrices;
+    std::vector<int64_t> quantities;
+    std::vector<int64_t> referenceFinalPrices;
+
+    // every fraction of quantity, prices of fractions end exactly on halves as well
+    for (int64_t fraction = 0; fraction < Quantity::Scale; fraction++)
+    {
+        for (const int64_t unitPrice : {0LL, 1LL, 2LL, 5LL, 499LL, 500LL, 1000LL, 123457LL, (1LL << 30) - 1})
+        {
+            unitPrices.push_back(unitPrice);
+            quantities.push_back((fraction * 7919) % ((1LL << 30) - Quantity::Scale) / Quantity::Scale * Quantity::Scale + fraction);
+        }
+    }
+    const int64_t referenceTotal = referencePriceLines(unitPrices, quantities, referenceFinalPrices);
+
+    for (const PricingKernel::Isa isa : cIsas)
+    {
+        std::vector<int64_t> finalPrices(unitPrices.size());
+
+        PricingKernel::setIsa(isa);
+        EXPECT_EQ(PricingKernel::priceLines(unitPrices.data(), quantities.data(), finalPrices.data(), finalPrices.size()), referenceTotal);
+        EXPECT_EQ(finalPrices, referenceFinalPrices);
+    }
+
+    PricingKernel::setIsa(initialIsa);
+}
+
+TEST(PricingKernel_TestSuite, ProcessedOrders_SameTotalForEveryIsa)
+{
+    const PricingKernel::Isa initialIsa = PricingKernel::getIsa();
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    std::ofstream writer;
+    Items item;
+    Orders order;
+    std::vector<Money> totals;
+    std::vector<std::string> bills;
+
+    // create files with ofstream
+    writer.open(item_filename);
+    for (int i = 0; i < 2000; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";" << i % 1000 << "." << i % 100 << ";" << i % 30 << "." << i % 10 << "\n";
+    }
+    writer.close();
+    writer.open(order_filename);
+    for (int i = 0; i < 2000; i++)
+    {
+        writer << 5720092400000 + i << ";" << i % 13 << "." << i % 1000 << "\n";
+    }
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+
+    for (const PricingKernel::Isa isa : cIsas)
+    {
+        ProcessedOrders proc;
+
+        PricingKernel::setIsa(isa);
+        ASSERT_NO_THROW(proc.processOrder(&order, &item));
+        totals.push_back(proc.getTotal());
+
+        writer.open("test_bill.txt");
+        proc >> writer;
+        writer.close();
+        std::ifstream bill("test_bill.txt");
+        bills.emplace_back(std::istreambuf_iterator<char>(bill), std::istreambuf_iterator<char>());
+    }
+    for (size_t i = 1; i < totals.size(); i++)
+    {
+        EXPECT_EQ(totals[i], totals[0]);
+        EXPECT_EQ(bills[i], bills[0]);
+    }
+
+    // make sure that file has been deleted
+    PricingKernel::setIsa(initialIsa);
+    std::remove(item_filename);
+    std::remove(order_filename);
+    std::remove("test_bill.txt");
+}
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <cstdint>
 #include <memory>
+#include <sstream>
 
 // GTest
 #include <gtest/gtest.h>
@@ -16,23 +17,23 @@
 
 TEST(ProcessOrders_TestSuite, CompareProcOrdersWithDifferentFields)
 {
-    const ProcessedOrder a = {1.11f, 1.21f, 3.0f, 15.67, 115.67};
-    const ProcessedOrder b = {1.21f, 1.11f, 3.0f, 15.67, 115.67};
+    const ProcessedOrder a = {Percent::parse("1.11"), Percent::parse("1.21"), Quantity::parse("3"), Money::parse("15.67"), Money::parse("115.67")};
+    const ProcessedOrder b = {Percent::parse("1.21"), Percent::parse("1.11"), Quantity::parse("3"), Money::parse("15.67"), Money::parse("115.67")};
 
     EXPECT_NE(a, b);
 }
 
 TEST(ProcessOrders_TestSuite, CompareProcOrdersWithSameFields)
 {
-    const ProcessedOrder a = {1.11f, 1.21f, 3.0f, 15.67, 115.67};
-    const ProcessedOrder b = {1.11f, 1.21f, 3.0f, 15.67, 115.67};
+    const ProcessedOrder a = {Percent::parse("1.11"), Percent::parse("1.21"), Quantity::parse("3"), Money::parse("15.67"), Money::parse("115.67")};
+    const ProcessedOrder b = {Percent::parse("1.11"), Percent::parse("1.21"), Quantity::parse("3"), Money::parse("15.67"), Money::parse("115.67")};
 
     EXPECT_EQ(a, b);
 }
 
 TEST(ProcessOrders_TestSuite, CompareSameProceOrder)
 {
-    const ProcessedOrder a = {1.11f, 1.21f, 3.0f, 15.67, 115.67};
+    const ProcessedOrder a = {Percent::parse("1.11"), Percent::parse("1.21"), Quantity::parse("3"), Money::parse("15.67"), Money::parse("115.67")};
 
     EXPECT_EQ(a, a);
 }
@@ -137,11 +138,12 @@ TEST(ProcessOrders_TestSuite, ProcessOrderSucceed_NullDiscounts)
     auto procOrder = proc.getProcessedOrder("Fanta");
 
     ASSERT_TRUE(procOrder != nullptr);
-    EXPECT_EQ(procOrder->discountPercent, 0);
-    EXPECT_EQ(procOrder->quantity, 1.00f);
-    EXPECT_EQ(procOrder->taxPercent, 3.5f);
-    EXPECT_EQ(procOrder->unitPrice, 1.21 * (1.0f + procOrder->taxPercent/100));
-    EXPECT_EQ(procOrder->finalPrice, procOrder->unitPrice * procOrder->quantity);
+    EXPECT_EQ(procOrder->discountPercent, Percent());
+    EXPECT_EQ(procOrder->quantity, Quantity::parse("1.00"));
+    EXPECT_EQ(procOrder->taxPercent, Percent::parse("3.5"));
+    // 1.21 * 1.035 = 1.252...
+    EXPECT_EQ(procOrder->unitPrice, Money::parse("1.25"));
+    EXPECT_EQ(procOrder->finalPrice, Money::parse("1.25"));
 
     // make sure that file has been deleted
     std::remove(item_filename);
@@ -190,14 +192,479 @@ TEST(ProcessOrders_TestSuite, ProcessOrderSucceed_IncludingDiscounts)
     auto procOrder = proc.getProcessedOrder("Fanta");
 
     ASSERT_TRUE(procOrder != nullptr);
-    EXPECT_EQ(procOrder->discountPercent, 5.12f);
-    EXPECT_EQ(procOrder->quantity, 1.00f);
-    EXPECT_EQ(procOrder->taxPercent, 3.5f);
-    EXPECT_EQ(procOrder->unitPrice, 1.21 * (1.0f + procOrder->taxPercent/100) * (1.0f - procOrder->discountPercent/100));
-    EXPECT_EQ(procOrder->finalPrice, procOrder->unitPrice * procOrder->quantity);
+    EXPECT_EQ(procOrder->discountPercent, Percent::parse("5.12"));
+    EXPECT_EQ(procOrder->quantity, Quantity::parse("1.00"));
+    EXPECT_EQ(procOrder->taxPercent, Percent::parse("3.5"));
+    // 1.21 * 1.035 * 0.9488 = 1.188...
+    EXPECT_EQ(procOrder->unitPrice, Money::parse("1.19"));
+    EXPECT_EQ(procOrder->finalPrice, Money::parse("1.19"));
 
     // make sure that file has been deleted
     std::remove(item_filename);
     std::remove(order_filename);
     std::remove(discount_filename);
 }
+
+TEST(ProcessOrders_TestSuite, WriteProcessedOrders_ShortensLongNames)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    const char* bill_filename = "test_bill.txt";
+    std::ofstream writer;
+    std::ifstream bill;
+    std::string line;
+    Items item;
+    Orders order;
+
+    // create file with ofstream & write some data for order
+    writer.open(order_filename);
+    writer << "5720092407427;1.00\n5720092407428;2.00";
+    writer.close();
+
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+
+    // create file with ofstream & write some data for item, one name is longer than bill column
+    writer.open(item_filename);
+    writer << "5720092407427;Fanta;1.21;3.5\n5720092407428;Very Long Name Of Product;2.50;3.5";
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+
+    // write bill
+    ProcessedOrders proc;
+    ASSERT_NO_THROW(proc.processOrder(&order, &item));
+    ASSERT_NE(proc.getProcessedOrder("Very Long Name Of Product"), nullptr);
+    writer.open(bill_filename);
+    proc >> writer;
+    writer.close();
+
+    // skip header, names are sorted & vertical bars stay below the header ones
+    bill.open(bill_filename);
+    for (int i = 0; i < 4; i++)
+    {
+        std::getline(bill, line);
+    }
+    std::getline(bill, line);
+    EXPECT_EQ(line.rfind("Fanta                 |    3.50", 0), 0u) << line;
+    std::getline(bill, line);
+    EXPECT_EQ(line.rfind("Very Long Name Of...  |    3.50", 0), 0u) << line;
+    bill.close();
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+    std::remove(bill_filename);
+}
+
+TEST(ProcessOrders_TestSuite, WriteProcessedOrders_ExactLayout)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    std::ostringstream writer;
+    std::ofstream file_writer;
+    Items item;
+    Orders order;
+
+    // create file with ofstream & write some data for order, cells of the 2nd item fill their columns (bars are dropped)
+    file_writer.open(order_filename);
+    file_writer << "5720092407427;2\n5720092407428;9999999.999";
+    file_writer.close();
+
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+
+    // create file with ofstream & write some data for item
+    file_writer.open(item_filename);
+    file_writer << "5720092407427;Fanta;1.21;3.5\n5720092407428;Big;99999.99;0";
+    file_writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+
+    ProcessedOrders proc;
+    ASSERT_NO_THROW(proc.processOrder(&order, &item));
+    const std::string order_line = "Order #" + std::to_string(proc.getOrderNum()) + "\n";
+
+    // bill is rendered at once, stream gets the same text
+    const std::string bill(proc.formatBill());
+    proc >> writer;
+    EXPECT_EQ(writer.str(), bill);
+    EXPECT_EQ(bill, order_line +
+        "------------------------------------------------------------------------------------\n"
+        "Name                  |     Tax  |   Disc.  |    U.price  |     Quant.  |      Price\n"
+        "------------------------------------------------------------------------------------\n"
+        "Big                   |    0.00  |    0.00  |   99999.99  |10000000.00999999899900.00\n"
+        "Fanta                 |    3.50  |    0.00  |       1.25  |       2.00  |       2.50\n"
+        "------------------------------------------------------------------------------------\n"
+        "Total                                                                999999899902.50");
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+}
+
+TEST(ProcessOrders_TestSuite, WriteProcessedOrders_KeepsItemsWithSameName)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    const char* bill_filename = "test_bill.txt";
+    std::ofstream writer;
+    std::ifstream bill;
+    std::string line;
+    Items item;
+    Orders order;
+
+    // create file with ofstream & write some data for order
+    writer.open(order_filename);
+    writer << "5720092407429;1.00\n5720092407427;2.00\n5720092407428;1.00";
+    writer.close();
+
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+
+    // create file with ofstream & write some data for item, two items share the name
+    writer.open(item_filename);
+    writer << "5720092407427;Fanta;1.00;0\n5720092407428;Apple;2.00;0\n5720092407429;Fanta;3.00;0";
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+
+    ProcessedOrders proc;
+    ASSERT_NO_THROW(proc.processOrder(&order, &item));
+
+    // every item keeps its own line, name lookup finds the lowest EAN 13
+    ASSERT_NE(proc.getProcessedOrder(5720092407427), nullptr);
+    ASSERT_NE(proc.getProcessedOrder(5720092407429), nullptr);
+    EXPECT_EQ(proc.getProcessedOrder(5720092407429)->finalPrice, Money::fromMinorUnits(300));
+    EXPECT_EQ(proc.getProcessedOrder(5720092407430), nullptr);
+    EXPECT_EQ(proc.getProcessedOrder("Fanta"), proc.getProcessedOrder(5720092407427));
+    EXPECT_EQ(proc.getProcessedOrder("Pepsi"), nullptr);
+
+    writer.open(bill_filename);
+    proc >> writer;
+    writer.close();
+
+    // skip header, lines are sorted by name & then by EAN 13, total matches sum of lines
+    bill.open(bill_filename);
+    for (int i = 0; i < 4; i++)
+    {
+        std::getline(bill, line);
+    }
+    std::getline(bill, line);
+    EXPECT_EQ(line.rfind("Apple ", 0), 0u) << line;
+    std::getline(bill, line);
+    EXPECT_EQ(line.rfind("Fanta ", 0), 0u) << line;
+    EXPECT_NE(line.find("2.00  |       2.00"), std::string::npos) << line;
+    std::getline(bill, line);
+    EXPECT_EQ(line.rfind("Fanta ", 0), 0u) << line;
+    EXPECT_NE(line.find("1.00  |       3.00"), std::string::npos) << line;
+    std::getline(bill, line);
+    std::getline(bill, line);
+    EXPECT_NE(line.find(" 7.00"), std::string::npos) << line;
+    bill.close();
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+    std::remove(bill_filename);
+}
+
+TEST(ProcessOrders_TestSuite, ProcessOrders_SteadyStateWithinArenas)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    const char* bill_filename = "test_bill.txt";
+    std::ofstream writer;
+    Items item;
+    Orders order;
+    ProcessedOrders proc;
+    size_t orderUpstreamAllocations = 0;
+    size_t procUpstreamAllocations = 0;
+
+    // create files with ofstream & write some data for items & order
+    writer.open(item_filename);
+    for (int i = 0; i < 1000; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";1.00;10\n";
+    }
+    writer.close();
+    writer.open(order_filename);
+    for (int i = 0; i < 1000; i++)
+    {
+        writer << 5720092400000 + i << ";2\n";
+    }
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+
+    // the same order again & again, arenas stop taking memory after the first rounds
+    for (int round = 0; round < 4; round++)
+    {
+        reader->open(order_filename);
+        ASSERT_NO_THROW(order << reader);
+        ASSERT_NO_THROW(proc.processOrder(&order, &item));
+        writer.open(bill_filename);
+        proc >> writer;
+        writer.close();
+
+        if (round == 2)
+        {
+            orderUpstreamAllocations = order.getArena().getNumOfUpstreamAllocations();
+            procUpstreamAllocations = proc.getArena().getNumOfUpstreamAllocations();
+        }
+    }
+    EXPECT_EQ(order.getArena().getNumOfUpstreamAllocations(), orderUpstreamAllocations);
+    EXPECT_EQ(proc.getArena().getNumOfUpstreamAllocations(), procUpstreamAllocations);
+    EXPECT_GT(order.getArena().getNumOfAllocations(), 0u);
+    EXPECT_GT(proc.getArena().getNumOfAllocations(), 0u);
+    ASSERT_NE(proc.getProcessedOrder(5720092400999), nullptr);
+    EXPECT_EQ(proc.getProcessedOrder(5720092400999)->finalPrice, Money::fromMinorUnits(220));
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+    std::remove(bill_filename);
+}
+
+TEST(ProcessOrders_TestSuite, ProcessOrderSucceed_SumsRepeatedItems)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    std::ofstream writer;
+    Items item;
+    Orders order;
+
+    // create file with ofstream & write some data for order, the same item is ordered 3 times
+    writer.open(order_filename);
+    writer << "5720092407427;1.5\n5720092407428;2\n5720092407427;2\n5720092407427;0.25";
+    writer.close();
+
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+
+    // create file with ofstream & write some data for item
+    writer.open(item_filename);
+    writer << "5720092407427;Fanta;1.00;0\n5720092407428;Apple;2.00;0";
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+
+    ProcessedOrders proc;
+    ASSERT_NO_THROW(proc.processOrder(&order, &item));
+    ASSERT_NE(proc.getProcessedOrder(5720092407427), nullptr);
+    EXPECT_EQ(proc.getProcessedOrder(5720092407427)->quantity, Quantity::fromMinorUnits(3750));
+    EXPECT_EQ(proc.getProcessedOrder(5720092407427)->finalPrice, Money::fromMinorUnits(375));
+    ASSERT_NE(proc.getProcessedOrder(5720092407428), nullptr);
+    EXPECT_EQ(proc.getProcessedOrder(5720092407428)->quantity, Quantity::fromMinorUnits(2000));
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+}
+
+TEST(ProcessOrders_TestSuite, ProcessOrderSucceed_SumsManyRepeatedItems)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    const int numOfItems = 1000;
+    const int numOfLines = 200000;
+    std::ofstream writer;
+    Items item;
+    Orders order;
+
+    // create files with ofstream, every item is ordered once per 1000 lines
+    writer.open(item_filename);
+    for (int i = 0; i < numOfItems; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";1.00;0\n";
+    }
+    writer.close();
+    writer.open(order_filename);
+    for (int i = 0; i < numOfLines; i++)
+    {
+        writer << 5720092400000 + (i * 7) % numOfItems << ";0.001\n";
+    }
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+
+    ProcessedOrders proc;
+    ASSERT_NO_THROW(proc.processOrder(&order, &item));
+    for (int i = 0; i < numOfItems; i++)
+    {
+        const ProcessedOrder* procOrder = proc.getProcessedOrder(5720092400000 + i);
+        ASSERT_NE(procOrder, nullptr);
+        EXPECT_EQ(procOrder->quantity, Quantity::fromMinorUnits(numOfLines / numOfItems));
+    }
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+}
+
+TEST(ProcessOrders_TestSuite, ProcessOrderFused_SameAsOrders)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* discount_filename = "test_discount.csv";
+    const char* order_filename = "test_order.csv";
+    const char* bill_filename = "test_bill.txt";
+    const char* fused_bill_filename = "test_fused_bill.txt";
+    std::ofstream writer;
+    std::ifstream bill;
+    std::stringstream bill_text;
+    std::stringstream fused_bill_text;
+    Items item;
+    Discounts discount;
+    Orders order;
+    ProcessedOrders proc;
+    ProcessedOrders fused;
+
+    // create files with ofstream & write some data, order repeats items & contains malformed row
+    writer.open(item_filename);
+    writer << "5720092407427;Fanta;1.21;3.5\n5720092407428;Apple;2.50;12\n5720092407429;Pear;0.99;3.5";
+    writer.close();
+    writer.open(discount_filename);
+    writer << "5720092407428;15";
+    writer.close();
+    writer.open(order_filename);
+    writer << "5720092407428;1.5\n5720092407427;3\nmalformed;1\n5720092407428;0.25\n5720092407429;7";
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(discount_filename);
+    ASSERT_NO_THROW(discount << reader);
+
+    // two stages: Orders & processOrder
+    order.setErrorBudget(1);
+    reader->open(order_filename);
+    ASSERT_NO_THROW(order << reader);
+    ASSERT_NO_THROW(proc.processOrder(&order, &item, &discount));
+
+    // fused mode
+    fused.setErrorBudget(1);
+    reader->open(order_filename);
+    ASSERT_NO_THROW(fused.processOrder(*reader, &item, &discount));
+    ASSERT_EQ(fused.getErrorReport().getErrors().size(), 1u);
+    EXPECT_EQ(fused.getErrorReport().getErrors()[0].row, 3u);
+    EXPECT_EQ(fused.getOrderNum(), proc.getOrderNum() + 1);
+
+    for (const uint64_t ean13 : {5720092407427ULL, 5720092407428ULL, 5720092407429ULL})
+    {
+        ASSERT_NE(fused.getProcessedOrder(ean13), nullptr);
+        EXPECT_EQ(*fused.getProcessedOrder(ean13), *proc.getProcessedOrder(ean13));
+    }
+
+    // bills differ only in order number
+    writer.open(bill_filename);
+    proc >> writer;
+    writer.close();
+    writer.open(fused_bill_filename);
+    fused >> writer;
+    writer.close();
+    bill.open(bill_filename);
+    bill_text << bill.rdbuf();
+    bill.close();
+    bill.open(fused_bill_filename);
+    fused_bill_text << bill.rdbuf();
+    bill.close();
+    const std::string text = bill_text.str();
+    const std::string fused_text = fused_bill_text.str();
+    EXPECT_EQ(text.substr(text.find('\n')), fused_text.substr(fused_text.find('\n')));
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(discount_filename);
+    std::remove(order_filename);
+    std::remove(bill_filename);
+    std::remove(fused_bill_filename);
+}
+
+TEST(ProcessOrders_TestSuite, ProcessOrderFused_BoundedByDistinctItems)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    const int numOfItems = 10;
+    const int numOfLines = 200000;
+    std::ofstream writer;
+    Items item;
+    ProcessedOrders proc;
+
+    // create files with ofstream, a few items are ordered again & again
+    writer.open(item_filename);
+    for (int i = 0; i < numOfItems; i++)
+    {
+        writer << 5720092400000 + i << ";Item" << i << ";0.10;0\n";
+    }
+    writer.close();
+    writer.open(order_filename);
+    for (int i = 0; i < numOfLines; i++)
+    {
+        writer << 5720092400000 + i % numOfItems << ";1\n";
+    }
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(order_filename);
+    ASSERT_NO_THROW(proc.processOrder(*reader, &item));
+
+    // memory holds batch buffers & lines, not rows
+    EXPECT_LE(proc.getArena().getCapacity(), static_cast<size_t>(64 * 1024));
+    for (int i = 0; i < numOfItems; i++)
+    {
+        const ProcessedOrder* procOrder = proc.getProcessedOrder(5720092400000 + i);
+        ASSERT_NE(procOrder, nullptr);
+        EXPECT_EQ(procOrder->quantity, Quantity::fromMinorUnits(numOfLines / numOfItems * Quantity::Scale));
+        EXPECT_EQ(procOrder->finalPrice, Money::fromMinorUnits(numOfLines / numOfItems * 10));
+    }
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+}
+
+TEST(ProcessOrders_TestSuite, ProcessOrderFusedFailure_MissingItem)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* item_filename = "test_item.csv";
+    const char* order_filename = "test_order.csv";
+    std::ofstream writer;
+    Items item;
+    ProcessedOrders proc;
+
+    // create files with ofstream, ordered item is missing
+    writer.open(item_filename);
+    writer << "5720092407427;Fanta;1.21;3.5";
+    writer.close();
+    writer.open(order_filename);
+    writer << "5720092407427;1\n5720092407428;1";
+    writer.close();
+
+    reader->open(item_filename);
+    ASSERT_NO_THROW(item << reader);
+    reader->open(order_filename);
+    EXPECT_THROW(proc.processOrder(*reader, &item), std::runtime_error);
+    reader->open(order_filename);
+    EXPECT_THROW(proc.processOrder(*reader, nullptr), std::runtime_error);
+
+    // make sure that file has been deleted
+    std::remove(item_filename);
+    std::remove(order_filename);
+}
@@ -0,0 +1,226 @@
+// standard library
+#include <string>
+#include <string_view>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <typeinfo>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <file_reader/RowSchema.h>
+#include <file_reader/MmapCsvReader.h>
+#include <file_reader/CsvReader.h>
+
+using ItemsSchema = RowSchema<Ean13Column, StringColumn, DoubleColumn, FloatColumn>;
+
+using OwnedItemsSchema = RowSchema<Ean13Column, OwnedStringColumn, DoubleColumn, FloatColumn>;
+
+static_assert(ItemsSchema::NumOfCols == 4);
+static_assert(RowSchema<Ean13Column, FloatColumn>::NumOfCols == 2);
+
+/**
+ * @brief Outcome of row decoding: decoded values or type & message of thrown exception
+ */
+struct Outcome
+{
+    uint64_t ean13 = 0;
+    std::string name;
+    double priceWoTax = 0;
+    float taxPercent = 0;
+    std::string exception;
+    std::string message;
+};
+
+/**
+ * @brief Decodes current row with extract* methods of reader (former way of decoding)
+ */
+static Outcome decodeWithExtract(IFileReader& reader)
+{
+    Outcome outcome;
+    auto validateEan13 = [](std::string_view to_validate, std::string& error)
+    {
+        if (to_validate.length() != EAN13_LEN)
+        {
+            error = "EAN13 shall be 13 digits long.";
+            return false;
+        }
+        return true;
+    };
+
+    try
+    {
+        outcome.ean13 = reader.extractULongLong(validateEan13);
+        outcome.name = reader.extractString();
+        outcome.priceWoTax = reader.extractDouble();
+        outcome.taxPercent = reader.extractFloat();
+    }
+    catch (const std::exception& e)
+    {
+        outcome = Outcome();
+        outcome.exception = typeid(e).name();
+        outcome.message = e.what();
+    }
+    return outcome;
+}
+
+/**
+ * @brief Decodes current row with RowSchema
+ */
+static Outcome decodeWithSchema(IFileReader& reader)
+{
+    Outcome outcome;
+    std::string_view name;
+
+    try
+    {
+        ItemsSchema::decode(reader, outcome.ean13, name, outcome.priceWoTax, outcome.taxPercent);
+        outcome.name = name;
+    }
+    catch (const std::exception& e)
+    {
+        outcome = Outcome();
+        outcome.exception = typeid(e).name();
+        outcome.message = e.what();
+    }
+    return outcome;
+}
+
+TEST(RowSchema_TestSuite, DecodeRow_SingleLineCheck)
+{
+    MmapCsvReader reader;
+    const char* filename = "test.csv";
+    uint64_t ean13;
+    std::string_view name;
+    double priceWoTax;
+    float taxPercent;
+
+    // create file with ofstream & write some data
+    std::ofstream writer(filename);
+    writer << "4432441693730;\t Coca-Cola;\t\t1.21;\t3.5\r\n";
+    writer.close();
+
+    // decode the only row
+    reader.open(filename);
+    ASSERT_TRUE(reader.read());
+    ItemsSchema::decode(reader, ean13, name, priceWoTax, taxPercent);
+
+    EXPECT_EQ(ean13, 4432441693730u);
+    EXPECT_EQ(name, "Coca-Cola");
+    EXPECT_EQ(priceWoTax, 1.21);
+    EXPECT_EQ(taxPercent, 3.5f);
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(RowSchema_TestSuite, DecodeRow_SameOutcomeAsExtract)
+{
+    MmapCsvReader schemaReader;
+    MmapCsvReader extractReader;
+    const char* filename = "test.csv";
+    const std::vector<std::string> rows =
+    {
+        "4432441693730;Coca-Cola;1.21;3.5",
+        "\t4432441693730 ;  Fanta\t;\t+.5;\t3.;",
+        "443244169373;Coca-Cola;1.21;3.5",
+        "44324416937301;Coca-Cola;1.21;3.5",
+        "4432441x93730;Coca-Cola;1.21;3.5",
+        "99999999999999999999;Coca-Cola;1.21;3.5",
+        "4432441693730;Coca-Cola;1.2.1;3.5",
+        "4432441693730;Coca-Cola;-1.21;3.5",
+        "4432441693730;Coca-Cola;.;3.5",
+        "4432441693730;Coca-Cola;1e400;3.5",
+        "4432441693730;Coca-Cola;1.21;1e-45",
+        "4432441693730;Coca-Cola;1.21",
+        "4432441693730;;1.21;3.5",
+        "4432441693730;Coca-Cola;1.21;",
+        "4432441693730;Coca-Cola;1.21;3.5;4.5",
+        "4432441693730",
+        "",
+    };
+
+    // create file with ofstream & write rows
+    std::ofstream writer(filename);
+    for (const std::string& row : rows)
+    {
+        writer << row << '\n';
+    }
+    writer.close();
+
+    schemaReader.open(filename);
+    extractReader.open(filename);
+    extractReader.setNumOfCols(ItemsSchema::NumOfCols);
+
+    // expect same values or same exception for every row
+    for (const std::string& row : rows)
+    {
+        ASSERT_TRUE(schemaReader.read());
+        ASSERT_TRUE(extractReader.read());
+
+        const Outcome schemaOutcome = decodeWithSchema(schemaReader);
+        const Outcome extractOutcome = decodeWithExtract(extractReader);
+
+        EXPECT_EQ(schemaOutcome.ean13, extractOutcome.ean13) << row;
+        EXPECT_EQ(schemaOutcome.name, extractOutcome.name) << row;
+        EXPECT_EQ(schemaOutcome.priceWoTax, extractOutcome.priceWoTax) << row;
+        EXPECT_EQ(schemaOutcome.taxPercent, extractOutcome.taxPercent) << row;
+        EXPECT_EQ(schemaOutcome.exception, extractOutcome.exception) << row;
+        EXPECT_EQ(schemaOutcome.message, extractOutcome.message) << row;
+    }
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
+
+TEST(RowSchema_TestSuite, ReadBatch_SkipsAndReportsFailedRows)
+{
+    CsvReader reader;
+    const char* filename = "test.csv";
+    std::vector<uint64_t> keys(3);
+    std::vector<std::string> names(3);
+    std::vector<double> pricesWoTax(3);
+    std::vector<float> taxPercents(3);
+    std::vector<RowError> errors;
+
+    // create file with ofstream & write 7 rows, 2nd & 5th are invalid
+    std::ofstream writer(filename);
+    writer << "4432441693731;A;1.1;1\n";
+    writer << "4432441693732;B;1.x;2\n";
+    writer << "4432441693733;C;1.3;3\n";
+    writer << "4432441693734;D;1.4;4\n";
+    writer << "443244169373;E;1.5;5\n";
+    writer << "4432441693736;F;1.6;6\n";
+    writer << "4432441693737;G;1.7;7";
+    writer.close();
+
+    reader.open(filename);
+
+    // full batch, failed row doesn't take a place within columns
+    ASSERT_EQ(reader.readBatch<OwnedItemsSchema>(errors, keys, names, pricesWoTax, taxPercents), 3u);
+    EXPECT_EQ(keys, (std::vector<uint64_t>{4432441693731, 4432441693733, 4432441693734}));
+    EXPECT_EQ(names, (std::vector<std::string>{"A", "C", "D"}));
+    EXPECT_EQ(pricesWoTax, (std::vector<double>{1.1, 1.3, 1.4}));
+    EXPECT_EQ(taxPercents, (std::vector<float>{1, 3, 4}));
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].row, 2u);
+    EXPECT_EQ(errors[0].column, 3);
+    EXPECT_EQ(errors[0].reason, "\"1.x\" is not a decimal number.");
+
+    // last batch is shorter than columns because of EOF
+    ASSERT_EQ(reader.readBatch<OwnedItemsSchema>(errors, keys, names, pricesWoTax, taxPercents), 2u);
+    EXPECT_EQ(keys[0], 4432441693736u);
+    EXPECT_EQ(names[1], "G");
+    ASSERT_EQ(errors.size(), 2u);
+    EXPECT_EQ(errors[1].row, 5u);
+    EXPECT_EQ(errors[1].column, 1);
+
+    // nothing left
+    EXPECT_EQ(reader.readBatch<OwnedItemsSchema>(errors, keys, names, pricesWoTax, taxPercents), 0u);
+    EXPECT_EQ(errors.size(), 2u);
+
+    // make sure that file has been deleted
+    std::remove(filename);
+}
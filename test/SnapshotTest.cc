@@ -0,0 +1,219 @@
+// standard library
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/Items.h>
+#include <objects/Discounts.h>
+#include <objects/Snapshot.h>
+#include <file_reader/CsvReader.h>
+
+#define SNAPSHOT_TEST_ROWS 1000
+
+/**
+ * @brief Writes items CSV & deserializes it
+ */
+static void writeItems(const char* filename, Items& items)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    std::ofstream writer(filename);
+    for (uint64_t i = 0; i < SNAPSHOT_TEST_ROWS; i++)
+    {
+        writer << 4432441600000 + i * 7 << ";\tItem " << i << ";\t" << i << ".5;\t" << i % 20 << "\n";
+    }
+    writer.close();
+
+    reader->open(filename);
+    items << reader;
+}
+
+TEST(Snapshot_TestSuite, SucceedItemsSnapshot_SameItemsAsCsv)
+{
+    Items csvItems;
+    Items snapshotItems;
+    const char* filename = "test.csv";
+    const std::string snapshotFilename = std::string(filename) + SNAPSHOT_EXTENSION;
+
+    writeItems(filename, csvItems);
+    csvItems.saveSnapshot(filename);
+
+    // expect every item to be found within mapped snapshot
+    ASSERT_TRUE(snapshotItems.loadSnapshot(filename));
+    for (uint64_t i = 0; i < SNAPSHOT_TEST_ROWS; i++)
+    {
+        const std::optional<Item> item = snapshotItems.getItem(4432441600000 + i * 7);
+        ASSERT_TRUE(item);
+        EXPECT_EQ(*item, *csvItems.getItem(4432441600000 + i * 7));
+    }
+    EXPECT_FALSE(snapshotItems.getItem(4432441600001));
+    EXPECT_FALSE(snapshotItems.getItem(0));
+    EXPECT_FALSE(snapshotItems.getItem(UINT64_MAX));
+
+    // make sure that files have been deleted
+    std::remove(filename);
+    std::remove(snapshotFilename.c_str());
+}
+
+TEST(Snapshot_TestSuite, FailedItemsSnapshot_StaleCsv)
+{
+    Items items;
+    const char* filename = "test.csv";
+    const std::string snapshotFilename = std::string(filename) + SNAPSHOT_EXTENSION;
+
+    writeItems(filename, items);
+    items.saveSnapshot(filename);
+
+    // change CSV file after snapshot has been written
+    std::ofstream writer(filename, std::ios::app);
+    writer << "4432441699999;\tNew Item;\t1.5;\t3\n";
+    writer.close();
+
+    // expect stale snapshot to be rejected & items to be cleared
+    EXPECT_FALSE(items.loadSnapshot(filename));
+    EXPECT_FALSE(items.getItem(4432441600000));
+
+    // make sure that files have been deleted
+    std::remove(filename);
+    std::remove(snapshotFilename.c_str());
+}
+
+TEST(Snapshot_TestSuite, FailedItemsSnapshot_CorruptedChecksum)
+{
+    Items items;
+    const char* filename = "test.csv";
+    const std::string snapshotFilename = std::string(filename) + SNAPSHOT_EXTENSION;
+
+    writeItems(filename, items);
+    items.saveSnapshot(filename);
+
+    // flip single byte within string pool
+    std::fstream snapshot(snapshotFilename, std::ios::in | std::ios::out | std::ios::binary);
+    snapshot.seekp(-3, std::ios::end);
+    snapshot.put('#');
+    snapshot.close();
+
+    EXPECT_FALSE(items.loadSnapshot(filename));
+
+    // make sure that files have been deleted
+    std::remove(filename);
+    std::remove(snapshotFilename.c_str());
+}
+
+TEST(Snapshot_TestSuite, FailedItemsSnapshot_NameOutOfPool)
+{
+    /**
+     * @brief the same layout as item record of Items
+     */
+    struct Record
+    {
+        uint64_t ean13;
+        int64_t priceWoTax;
+        int32_t taxPercent;
+        uint32_t nameLength;
+        uint64_t nameOffset;
+    };
+    Items items;
+    const char* filename = "test.csv";
+    const std::string snapshotFilename = std::string(filename) + SNAPSHOT_EXTENSION;
+
+    writeItems(filename, items);
+
+    // checksum is valid, but name of the 2nd record ends behind string pool
+    const Record records[] = {{4432441600000, 150, 300, 4, 0}, {4432441600007, 250, 300, 4, 2}};
+    Snapshot::write(filename, SnapshotType::Items, records, sizeof(Record), 2, "Item", 0);
+
+    EXPECT_FALSE(items.loadSnapshot(filename));
+    EXPECT_EQ(items.getNumOfItems(), 0u);
+
+    // make sure that files have been deleted
+    std::remove(filename);
+    std::remove(snapshotFilename.c_str());
+}
+
+TEST(Snapshot_TestSuite, FailedItemsSnapshot_StricterErrorBudget)
+{
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    Items lenientItems;
+    Items items;
+    const char* filename = "test.csv";
+    const std::string snapshotFilename = std::string(filename) + SNAPSHOT_EXTENSION;
+
+    // CSV file with single malformed row is deserialized leniently
+    std::ofstream writer(filename);
+    writer << "4432441600000;\tItem;\t1.5;\t3\n";
+    writer << "malformed;\tItem;\t1.5;\t3\n";
+    writer.close();
+    lenientItems.setErrorBudget(1);
+    reader->open(filename);
+    ASSERT_NO_THROW(lenientItems << reader);
+    lenientItems.saveSnapshot(filename);
+
+    // strict deserialization would fail, so its snapshot is rejected
+    EXPECT_FALSE(items.loadSnapshot(filename));
+    items.setErrorBudget(1);
+    EXPECT_TRUE(items.loadSnapshot(filename));
+    EXPECT_TRUE(items.getItem(4432441600000));
+
+    // make sure that files have been deleted
+    std::remove(filename);
+    std::remove(snapshotFilename.c_str());
+}
+
+TEST(Snapshot_TestSuite, FailedSnapshot_MissingOrOtherType)
+{
+    Items items;
+    Discounts discounts;
+    const char* filename = "test.csv";
+    const std::string snapshotFilename = std::string(filename) + SNAPSHOT_EXTENSION;
+
+    // no snapshot at all
+    writeItems(filename, items);
+    std::remove(snapshotFilename.c_str());
+    EXPECT_FALSE(items.loadSnapshot(filename));
+
+    // items snapshot can't be used as discounts one
+    writeItems(filename, items);
+    items.saveSnapshot(filename);
+    EXPECT_FALSE(discounts.loadSnapshot(filename));
+
+    // make sure that files have been deleted
+    std::remove(filename);
+    std::remove(snapshotFilename.c_str());
+}
+
+TEST(Snapshot_TestSuite, SucceedDiscountsSnapshot_SameDiscountsAsCsv)
+{
+    Discounts csvDiscounts;
+    Discounts snapshotDiscounts;
+    std::shared_ptr<CsvReader> reader(new CsvReader);
+    const char* filename = "test.csv";
+    const std::string snapshotFilename = std::string(filename) + SNAPSHOT_EXTENSION;
+
+    // create file with ofstream & write some data
+    std::ofstream writer(filename);
+    writer << "4432441693730;\t30\n";
+    writer << "1020304050607;\t12.5\n";
+    writer.close();
+
+    reader->open(filename);
+    csvDiscounts << reader;
+    csvDiscounts.saveSnapshot(filename);
+
+    ASSERT_TRUE(snapshotDiscounts.loadSnapshot(filename));
+    ASSERT_NE(snapshotDiscounts.getDiscount(4432441693730), nullptr);
+    EXPECT_EQ(snapshotDiscounts.getDiscount(4432441693730)->discountPercent, Percent::parse("30"));
+    ASSERT_NE(snapshotDiscounts.getDiscount(1020304050607), nullptr);
+    EXPECT_EQ(*snapshotDiscounts.getDiscount(1020304050607), *csvDiscounts.getDiscount(1020304050607));
+    EXPECT_EQ(snapshotDiscounts.getDiscount(1020304050608), nullptr);
+
+    // make sure that files have been deleted
+    std::remove(filename);
+    std::remove(snapshotFilename.c_str());
+}
@@ -0,0 +1,50 @@
+// standard library
+#include <string>
+#include <string_view>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <objects/StringPool.h>
+
+TEST(StringPool_TestSuite, SucceedAdd_ViewsStayValid)
+{
+    StringPool pool;
+    std::vector<std::string> strings;
+    std::vector<std::string_view> views;
+
+    // small strings fill many blocks, big ones get their own block
+    for (size_t i = 0; i < 20000; i++)
+    {
+        strings.push_back("Item " + std::to_string(i) + std::string(i % 7 == 0 ? 20000 : 0, 'x'));
+        views.push_back(pool.add(strings.back()));
+    }
+
+    for (size_t i = 0; i < strings.size(); i++)
+    {
+        ASSERT_EQ(views[i], strings[i]);
+        ASSERT_NE(views[i].data(), strings[i].data());
+    }
+    EXPECT_EQ(pool.add(""), "");
+}
+
+TEST(StringPool_TestSuite, SucceedMerge_ViewsOfOtherPoolStayValid)
+{
+    StringPool pool;
+    StringPool other;
+
+    const std::string_view first = pool.add("Coca-Cola");
+    const std::string_view second = other.add("Fanta");
+
+    pool.merge(other);
+    StringPool moved(std::move(pool));
+
+    // moved-from pool is empty & still usable
+    EXPECT_EQ(pool.add("Sprite"), "Sprite");
+    EXPECT_EQ(other.add("Pepsi"), "Pepsi");
+    EXPECT_EQ(first, "Coca-Cola");
+    EXPECT_EQ(second, "Fanta");
+    EXPECT_EQ(moved.add("Water"), "Water");
+}
@@ -0,0 +1,30 @@
+/**
+ * @file TestUtils.h
+ * @author Jovan Slavujevic (slavujevic.jovan.96@gmail.com)
+ * @brief Helpers shared by tests
+ * @version 0.2
+ * @date 2022-06-08
+ *
+ * @copyright Copyright (c) 2022
+ *
+ */
+
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Reads whole file into string
+ *
+ * @param[in] filename - file to read
+ * @return std::string - content of file (empty if file can't be opened)
+ */
+inline std::string readFile(const std::string& filename)
+{
+    std::ifstream reader(filename);
+    std::stringstream content;
+    content << reader.rdbuf();
+    return content.str();
+}
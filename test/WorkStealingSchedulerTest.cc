@@ -0,0 +1,162 @@
+// standard library
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// AmazingAPI
+#include <concurrency/WorkStealingScheduler.h>
+
+/**
+ * @brief Sums range of numbers, range longer than 100 is split into two subtasks
+ */
+static uint64_t sumRange(WorkStealingScheduler& scheduler, uint64_t begin, uint64_t end)
+{
+    if (end - begin <= 100)
+    {
+        uint64_t sum = 0;
+        for (uint64_t i = begin; i < end; i++)
+        {
+            sum += i;
+        }
+        return sum;
+    }
+
+    uint64_t left = 0;
+    uint64_t right = 0;
+    const uint64_t middle = begin + (end - begin) / 2;
+    TaskGroup group;
+    scheduler.submit(group, [&scheduler, &left, begin, middle]() { left = sumRange(scheduler, begin, middle); });
+    scheduler.submit(group, [&scheduler, &right, middle, end]() { right = sumRange(scheduler, middle, end); });
+    scheduler.wait(group);
+    return left + right;
+}
+
+TEST(WorkStealingScheduler_TestSuite, SucceedWait_EveryTaskExecuted)
+{
+    WorkStealingScheduler scheduler(4);
+    std::atomic<size_t> counter = 0;
+    TaskGroup group;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        scheduler.submit(group, [&counter]() { counter++; });
+    }
+    scheduler.wait(group);
+
+    EXPECT_EQ(counter, 1000u);
+    EXPECT_EQ(scheduler.getNumOfThreads(), 4u);
+}
+
+TEST(WorkStealingScheduler_TestSuite, SucceedWait_NestedSubtasks)
+{
+    // every level waits for its subtasks, waiting workers execute other tasks meanwhile
+    for (size_t numThreads : {1, 2, 4})
+    {
+        WorkStealingScheduler scheduler(numThreads);
+        uint64_t sum = 0;
+        TaskGroup group;
+
+        scheduler.submit(group, [&scheduler, &sum]() { sum = sumRange(scheduler, 0, 100000); });
+        scheduler.wait(group);
+        EXPECT_EQ(sum, 100000ULL * 99999 / 2);
+    }
+}
+
+TEST(WorkStealingScheduler_TestSuite, SucceedWait_IdleWorkersStealSubtasks)
+{
+    WorkStealingScheduler scheduler(4);
+    std::atomic<size_t> counter = 0;
+    TaskGroup group;
+
+    // single task spawns many slow subtasks into its own queue
+    scheduler.submit(group, [&scheduler, &counter]()
+    {
+        TaskGroup subtasks;
+        for (int i = 0; i < 64; i++)
+        {
+            scheduler.submit(subtasks, [&counter]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                counter++;
+            });
+        }
+        scheduler.wait(subtasks);
+    });
+    scheduler.wait(group);
+
+    EXPECT_EQ(counter, 64u);
+    EXPECT_GT(scheduler.getNumOfSteals(), 0u);
+}
+
+TEST(WorkStealingScheduler_TestSuite, SucceedWait_WaiterSkipsUnrelatedTasks)
+{
+    WorkStealingScheduler scheduler(2);
+    std::thread::id waiter;
+    std::atomic<bool> waited = false;
+    std::atomic<bool> nested = false;
+    TaskGroup group;
+
+    // task waits for slow subtask while unrelated task of outer group is queued behind it,
+    // unrelated task may be stolen by the other worker but it must not run within the wait
+    scheduler.submit(group, [&scheduler, &group, &waiter, &waited, &nested]()
+    {
+        TaskGroup subtasks;
+        waiter = std::this_thread::get_id();
+        scheduler.submit(subtasks, []() { std::this_thread::sleep_for(std::chrono::milliseconds(50)); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        scheduler.submit(group, [&waiter, &waited, &nested]() { nested = (std::this_thread::get_id() == waiter && !waited); });
+        scheduler.wait(subtasks);
+        waited = true;
+    });
+    scheduler.wait(group);
+
+    EXPECT_FALSE(nested);
+}
+
+TEST(WorkStealingScheduler_TestSuite, FailedWait_RethrowsTaskException)
+{
+    WorkStealingScheduler scheduler(2);
+    std::atomic<size_t> counter = 0;
+    TaskGroup group;
+
+    for (int i = 0; i < 100; i++)
+    {
+        scheduler.submit(group, [&counter, i]()
+        {
+            if (i == 50)
+            {
+                throw std::runtime_error("task failed");
+            }
+            counter++;
+        });
+    }
+
+    // the other tasks are finished anyway
+    EXPECT_THROW(scheduler.wait(group), std::runtime_error);
+    EXPECT_EQ(counter, 99u);
+
+    // group may be reused
+    scheduler.submit(group, [&counter]() { counter++; });
+    EXPECT_NO_THROW(scheduler.wait(group));
+    EXPECT_EQ(counter, 100u);
+}
+
+TEST(WorkStealingScheduler_TestSuite, SucceedDestroy_FinishesQueuedTasks)
+{
+    std::atomic<size_t> counter = 0;
+    TaskGroup group;
+    {
+        WorkStealingScheduler scheduler(2);
+        for (int i = 0; i < 100; i++)
+        {
+            scheduler.submit(group, [&counter]() { counter++; });
+        }
+    }
+    EXPECT_EQ(counter, 100u);
+}
@@ -1,11 +1,34 @@
 TEMPLATE = app
 
+CONFIG += thread
+
 TARGET = AmazingTests
 
+HEADERS += TestUtils.h
+
 SOURCES += test.cc
+SOURCES += BillSinkTest.cc
+SOURCES += BinaryBillReaderTest.cc
+SOURCES += BufferCsvReaderTest.cc
 SOURCES += CsvReaderTest.cc
+SOURCES += CsvTokenizerTest.cc
+SOURCES += MmapCsvReaderTest.cc
+SOURCES += NumberParserTest.cc
+SOURCES += RowSchemaTest.cc
+SOURCES += ArenaTest.cc
+SOURCES += EanMapTest.cc
+SOURCES += FixedPointTest.cc
 SOURCES += ItemsTest.cc
+SOURCES += OrderBatchTest.cc
+SOURCES += OrderPipelineTest.cc
+SOURCES += PriceTableTest.cc
+SOURCES += PricingKernelTest.cc
 SOURCES += ProcessedOrdersTest.cc
+SOURCES += SnapshotTest.cc
+SOURCES += StringPoolTest.cc
+SOURCES += AsyncIoTest.cc
+SOURCES += BoundedQueueTest.cc
+SOURCES += WorkStealingSchedulerTest.cc
 
 LIBS += -L$$OUT_PWD/../lib -lAmazingAPI
 LIBS += -lgtest -lgtest_main